@@ -0,0 +1,399 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <array>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ll_lib/ll_lib.hpp>
+#include <ll_lib/dl_xor_list.hpp>
+#include <ll_lib/node_arena.hpp>
+#include <ll_lib/spsc_queue.hpp>
+
+#if defined(__linux__)
+#	include <linux/perf_event.h>
+#	include <sys/ioctl.h>
+#	include <sys/syscall.h>
+#	include <unistd.h>
+#endif
+
+
+namespace
+{
+	//======== ======== ======== Counters ======== ======== ========
+
+	///	\brief Data TLB read miss counter, only available on linux with perf events enabled.
+	class dtlb_counter
+	{
+	public:
+		dtlb_counter()
+		{
+#if defined(__linux__)
+			perf_event_attr attr;
+			memset(&attr, 0, sizeof(attr));
+			attr.type           = PERF_TYPE_HW_CACHE;
+			attr.size           = sizeof(attr);
+			attr.config         = PERF_COUNT_HW_CACHE_DTLB
+				| (PERF_COUNT_HW_CACHE_OP_READ << 8)
+				| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+			attr.disabled       = 1;
+			attr.exclude_kernel = 1;
+			attr.exclude_hv     = 1;
+			m_fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+#endif
+		}
+
+		~dtlb_counter()
+		{
+#if defined(__linux__)
+			if(m_fd >= 0) close(m_fd);
+#endif
+		}
+
+		dtlb_counter(dtlb_counter const&)             = delete;
+		dtlb_counter& operator = (dtlb_counter const&) = delete;
+
+		[[nodiscard]] bool valid() const { return m_fd >= 0; }
+
+		void start()
+		{
+#if defined(__linux__)
+			if(m_fd < 0) return;
+			ioctl(m_fd, PERF_EVENT_IOC_RESET, 0);
+			ioctl(m_fd, PERF_EVENT_IOC_ENABLE, 0);
+#endif
+		}
+
+		uint64_t stop()
+		{
+			uint64_t count = 0;
+#if defined(__linux__)
+			if(m_fd < 0) return 0;
+			ioctl(m_fd, PERF_EVENT_IOC_DISABLE, 0);
+			if(read(m_fd, &count, sizeof(count)) != sizeof(count)) count = 0;
+#endif
+			return count;
+		}
+
+	private:
+		int m_fd = -1;
+	};
+
+	[[nodiscard]] double elapsed_ns(std::chrono::steady_clock::time_point const p_start)
+	{
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - p_start).count());
+	}
+
+	struct bench_result
+	{
+		double   ns_per_node;
+		uint64_t dtlb_misses;
+	};
+
+	//======== ======== ======== Traversal ======== ======== ========
+
+	template<typename List>
+	[[nodiscard]] bench_result traverse(List const& p_list, uintptr_t const p_count, uintptr_t const p_rounds)
+	{
+		dtlb_counter counter;
+		uint64_t sum = 0;
+
+		counter.start();
+		auto const start = std::chrono::steady_clock::now();
+		for(uintptr_t round = 0; round < p_rounds; ++round)
+		{
+			for(uint64_t const val : p_list)
+			{
+				sum += val;
+			}
+		}
+		auto const stop = std::chrono::steady_clock::now();
+		uint64_t const misses = counter.stop();
+
+		//keep the traversal alive
+		if(sum == 0x5555555555555555) std::puts("");
+
+		double const ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+		return bench_result{ns / static_cast<double>(p_count * p_rounds), misses / p_rounds};
+	}
+
+	///	\brief Fills \p p_list while interleaving unrelated heap allocations, as a long running process would.
+	template<typename List>
+	void fill_fragmented(List& p_list, uintptr_t const p_count)
+	{
+		std::mt19937 gen(1234);
+		std::uniform_int_distribution<uint32_t> noise_size(16, 256);
+		std::vector<std::unique_ptr<char[]>> noise;
+		noise.reserve(p_count);
+
+		for(uintptr_t i = 0; i < p_count; ++i)
+		{
+			p_list.push_back(i);
+			noise.emplace_back(new char[noise_size(gen)]);
+		}
+	}
+
+	void print_result(char const* const p_name, bench_result const& p_result, bool const p_has_counter)
+	{
+		if(p_has_counter)
+		{
+			std::printf("%-28s %10.3f ns/node %14llu dTLB misses/pass\n", p_name, p_result.ns_per_node,
+				static_cast<unsigned long long>(p_result.dtlb_misses));
+		}
+		else
+		{
+			std::printf("%-28s %10.3f ns/node %14s dTLB misses/pass\n", p_name, p_result.ns_per_node, "n/a");
+		}
+	}
+
+	void bench_arena(uintptr_t const p_count)
+	{
+		constexpr uintptr_t rounds = 4;
+		bool const has_counter = dtlb_counter{}.valid();
+
+		std::printf("== traversal, %llu nodes ==\n", static_cast<unsigned long long>(p_count));
+		{
+			dl_list<uint64_t> list;
+			fill_fragmented(list, p_count);
+			print_result("dl_heap_node_allocator", traverse(list, p_count, rounds), has_counter);
+		}
+		{
+			dl_list<uint64_t, dl_arena_node_allocator> list;
+			fill_fragmented(list, p_count);
+			print_result(list.get_allocator().huge_pages() ? "dl_arena_node_allocator(2M)" : "dl_arena_node_allocator(4K)",
+				traverse(list, p_count, rounds), has_counter);
+		}
+	}
+
+	//======== ======== ======== Trait fast paths ======== ======== ========
+
+	///	\brief Owning handle, opted into trivial relocation.
+	class relocatable_handle
+	{
+	public:
+		relocatable_handle(uint64_t const p_val): m_val{new uint64_t{p_val}} {}
+		relocatable_handle(relocatable_handle const& p_other): m_val{new uint64_t{*p_other.m_val}} {}
+		relocatable_handle(relocatable_handle&& p_other) noexcept: m_val{p_other.m_val} { p_other.m_val = nullptr; }
+		~relocatable_handle() { delete m_val; }
+	private:
+		uint64_t* m_val;
+	};
+} //namespace
+
+template<>
+struct dl_is_trivially_relocatable<relocatable_handle>: std::true_type {};
+
+namespace
+{
+	///	\brief Copy, compact and teardown cost per node.
+	template<typename List, typename Make>
+	void bench_lifecycle(char const* const p_name, uintptr_t const p_count, Make const& p_make)
+	{
+		double copy_ns;
+		double compact_ns;
+		double teardown_ns;
+		{
+			List list;
+			for(uintptr_t i = 0; i < p_count; ++i)
+			{
+				list.emplace(list.end(), p_make(i));
+			}
+
+			auto start = std::chrono::steady_clock::now();
+			List copy{list};
+			copy_ns = elapsed_ns(start);
+
+			start = std::chrono::steady_clock::now();
+			copy.compact();
+			compact_ns = elapsed_ns(start);
+
+			start = std::chrono::steady_clock::now();
+			copy.clear();
+			teardown_ns = elapsed_ns(start);
+		}
+
+		double const count = static_cast<double>(p_count);
+		std::printf("%-36s copy %8.3f ns/node  compact %8.3f ns/node  clear %8.3f ns/node\n",
+			p_name, copy_ns / count, compact_ns / count, teardown_ns / count);
+	}
+
+	void bench_traits(uintptr_t const p_count)
+	{
+		std::printf("== trait fast paths, %llu nodes ==\n", static_cast<unsigned long long>(p_count));
+
+		auto const make_int    = [](uintptr_t const i) { return static_cast<uint64_t>(i); };
+		auto const make_handle = [](uintptr_t const i) { return relocatable_handle{i}; };
+		auto const make_string = [](uintptr_t const i) { return std::to_string(i); };
+
+		bench_lifecycle<dl_list<uint64_t>>                                    ("trivial, heap",                p_count, make_int);
+		bench_lifecycle<dl_list<uint64_t, dl_arena_node_allocator>>           ("trivial, arena",               p_count, make_int);
+		bench_lifecycle<dl_list<relocatable_handle>>                          ("trivially relocatable, heap",  p_count, make_handle);
+		bench_lifecycle<dl_list<relocatable_handle, dl_arena_node_allocator>> ("trivially relocatable, arena", p_count, make_handle);
+		bench_lifecycle<dl_list<std::string>>                                 ("non-trivial, heap",            p_count, make_string);
+		bench_lifecycle<dl_list<std::string, dl_arena_node_allocator>>        ("non-trivial, arena",           p_count, make_string);
+	}
+
+	//======== ======== ======== XOR linked ======== ======== ========
+
+	///	\brief Node footprint, build and traversal cost; arena backed so that footprint is exactly the node size.
+	template<typename List>
+	void bench_footprint(char const* const p_name, uintptr_t const p_count)
+	{
+		constexpr uintptr_t rounds = 4;
+		List list;
+
+		auto const start = std::chrono::steady_clock::now();
+		for(uintptr_t i = 0; i < p_count; ++i)
+		{
+			list.push_back(static_cast<uint32_t>(i));
+		}
+		double const build_ns = elapsed_ns(start);
+
+		uint32_t sum = 0;
+		auto const traverse_start = std::chrono::steady_clock::now();
+		for(uintptr_t round = 0; round < rounds; ++round)
+		{
+			for(uint32_t const val : list)
+			{
+				sum += val;
+			}
+		}
+		double const traverse_ns = elapsed_ns(traverse_start);
+		if(sum == 0x55555555) std::puts("");
+
+		double const count = static_cast<double>(p_count);
+		std::printf("%-28s %3llu bytes/node  push_back %8.3f ns/node  traversal %8.3f ns/node\n",
+			p_name, static_cast<unsigned long long>(sizeof(typename List::_Container_t)),
+			build_ns / count, traverse_ns / (count * rounds));
+	}
+
+	void bench_xor(uintptr_t const p_count)
+	{
+		std::printf("== xor linked, %llu uint32_t nodes ==\n", static_cast<unsigned long long>(p_count));
+		bench_footprint<dl_list    <uint32_t, dl_arena_node_allocator>>("dl_list",     p_count);
+		bench_footprint<dl_xor_list<uint32_t, dl_arena_node_allocator>>("dl_xor_list", p_count);
+	}
+
+	//======== ======== ======== SPSC handoff ======== ======== ========
+
+	void print_throughput(char const* const p_name, uint64_t const p_count, double const p_ns)
+	{
+		std::printf("%-28s %10.2f M msgs/s\n", p_name, static_cast<double>(p_count) * 1000.0 / p_ns);
+	}
+
+	///	\brief Baseline, dl_list guarded by a mutex.
+	void bench_locked_list(uint64_t const p_count)
+	{
+		std::mutex lock;
+		dl_list<uint64_t> list;
+
+		auto const start = std::chrono::steady_clock::now();
+		std::thread producer(
+			[&]()
+			{
+				for(uint64_t i = 0; i < p_count; ++i)
+				{
+					std::lock_guard<std::mutex> const guard(lock);
+					list.push_back(i);
+				}
+			});
+
+		uint64_t received = 0;
+		uint64_t sum = 0;
+		while(received < p_count)
+		{
+			std::lock_guard<std::mutex> const guard(lock);
+			while(!list.empty())
+			{
+				sum += *list.begin();
+				list.pop_front();
+				++received;
+			}
+		}
+		producer.join();
+		if(sum == 1) std::puts("");
+
+		print_throughput("mutex + dl_list", p_count, elapsed_ns(start));
+	}
+
+	template<uintptr_t Batch>
+	void bench_spsc_queue(char const* const p_name, uint64_t const p_count)
+	{
+		dl_spsc_queue<uint64_t> queue{4096};
+
+		auto const start = std::chrono::steady_clock::now();
+		std::thread producer(
+			[&]()
+			{
+				std::array<uint64_t, Batch> batch;
+				uint64_t next = 0;
+				while(next < p_count)
+				{
+					uintptr_t pushed;
+					if constexpr(Batch == 1)
+					{
+						pushed = queue.try_push(next) ? 1 : 0;
+					}
+					else
+					{
+						for(uintptr_t i = 0; i < Batch; ++i) batch[i] = next + i;
+						uint64_t const remaining = p_count - next;
+						pushed = queue.push_batch(batch.begin(), remaining < Batch ? remaining : Batch);
+					}
+					//only hit when the queue is full, keeps oversubscribed machines making progress
+					if(!pushed) std::this_thread::yield();
+					next += pushed;
+				}
+			});
+
+		std::array<uint64_t, Batch> batch;
+		uint64_t received = 0;
+		uint64_t sum = 0;
+		while(received < p_count)
+		{
+			uintptr_t const count = queue.pop_batch(batch.begin(), Batch);
+			if(!count) std::this_thread::yield();
+			for(uintptr_t i = 0; i < count; ++i) sum += batch[i];
+			received += count;
+		}
+		producer.join();
+		if(sum == 1) std::puts("");
+
+		print_throughput(p_name, p_count, elapsed_ns(start));
+	}
+
+	void bench_spsc(uintptr_t const p_count)
+	{
+		uint64_t const count = static_cast<uint64_t>(p_count) * 10;
+		std::printf("== spsc handoff, %llu messages, %u hardware threads ==\n",
+			static_cast<unsigned long long>(count), std::thread::hardware_concurrency());
+		bench_locked_list(count);
+		bench_spsc_queue<1> ("dl_spsc_queue, batch 1",  count);
+		bench_spsc_queue<64>("dl_spsc_queue, batch 64", count);
+	}
+} //namespace
+
+int main(int argc, char* argv[])
+{
+	uintptr_t const count = argc > 1 ? static_cast<uintptr_t>(std::strtoull(argv[1], nullptr, 10)) : 10000000;
+
+	bench_arena(count);
+	bench_traits(count);
+	bench_xor(count);
+	bench_spsc(count);
+
+	return 0;
+}
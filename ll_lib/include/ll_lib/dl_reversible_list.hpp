@@ -0,0 +1,448 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "ll_lib.hpp"
+
+template<typename T, typename NodeAllocator = dl_heap_node_allocator>
+class dl_reversible_list;
+
+namespace _p
+{
+	template<typename T>
+	struct _FlipContainer;
+
+	///	\brief Node links indexed by direction, link[d] is the neighbour when walking in direction d.
+	template<typename T>
+	struct _FlipContainerHeader
+	{
+	public:
+		_FlipContainerHeader();
+		_FlipContainer<T>* link[2];
+	};
+
+	template<typename T>
+	struct _FlipContainer: public _FlipContainerHeader<T>
+	{
+	public:
+		template <class... Args>
+		inline _FlipContainer(Args&&... args) :_FlipContainerHeader<T>(), obj{std::forward<Args>(args)...} {}
+
+		T obj;
+	};
+
+	template<typename T>
+	inline _FlipContainerHeader<T>::_FlipContainerHeader(): link{static_cast<_FlipContainer<T>*>(this), static_cast<_FlipContainer<T>*>(this)} {};
+
+	///	\brief Direction of an iterator, either fixed at compile time (0 or 1) or carried at run time (-1).
+	template<int Dir>
+	struct _FlipDir
+	{
+		static_assert(Dir == 0 || Dir == 1);
+		inline _FlipDir() = default;
+		inline _FlipDir(uint8_t) noexcept {}
+		[[nodiscard]] static constexpr uint8_t get() noexcept { return static_cast<uint8_t>(Dir); }
+	};
+
+	template<>
+	struct _FlipDir<-1>
+	{
+		inline _FlipDir() = default;
+		inline _FlipDir(uint8_t const p_dir) noexcept: value(p_dir) {}
+		[[nodiscard]] inline uint8_t get() const noexcept { return value; }
+		uint8_t value = 0;
+	};
+
+	template<typename T, int Dir>
+	class _FlipConstIterator
+	{
+		template<typename, typename>
+		friend class ::dl_reversible_list;
+		template<typename, int>
+		friend class _FlipConstIterator;
+	protected:
+		using _NodePtr        = _FlipContainer<T>*;
+
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type      = T;
+		using difference_type = intptr_t;
+		using pointer         = value_type*;
+		using reference       = value_type&;
+
+	public:
+		inline _FlipConstIterator()                          = default;
+		inline _FlipConstIterator(_FlipConstIterator const&) = default;
+		inline _FlipConstIterator(_FlipConstIterator&&)      = default;
+
+		///	\brief A direction specialized iterator decays into a run time one.
+		template<int OtherDir, typename = std::enable_if_t<Dir == -1 && OtherDir != -1>>
+		inline _FlipConstIterator(_FlipConstIterator<T, OtherDir> const& p_other) noexcept
+			: _container(p_other._container), _dir(p_other._dir.get()) {}
+
+	public:
+		[[nodiscard]] inline bool operator == (_FlipConstIterator const& p_other) const noexcept { return p_other._container == _container; }
+
+		inline _FlipConstIterator& operator = (_FlipConstIterator const& p_other) noexcept = default;
+		inline _FlipConstIterator& operator = (_FlipConstIterator&& p_other) noexcept = default;
+
+		inline _FlipConstIterator& operator ++()
+		{
+			_container = _container->link[_dir.get()];
+			return *this;
+		}
+
+		inline _FlipConstIterator operator ++(int)
+		{
+			_FlipConstIterator temp = *this;
+			_container = _container->link[_dir.get()];
+			return temp;
+		}
+
+		inline _FlipConstIterator& operator --()
+		{
+			_container = _container->link[_dir.get() ^ 1];
+			return *this;
+		}
+
+		inline _FlipConstIterator operator --(int)
+		{
+			_FlipConstIterator temp = *this;
+			_container = _container->link[_dir.get() ^ 1];
+			return temp;
+		}
+
+		[[nodiscard]] value_type const& operator*() const noexcept
+		{
+			return _container->obj;
+		}
+
+		[[nodiscard]] value_type const* operator->() const noexcept
+		{
+			return &(_container->obj);
+		}
+
+	protected:
+		inline _FlipConstIterator(_FlipContainer<T>* const pos, uint8_t const p_dir) noexcept: _container(pos), _dir(p_dir) {}
+		_NodePtr _container = nullptr;
+		[[no_unique_address]] _FlipDir<Dir> _dir;
+	};
+
+	template<typename T, int Dir>
+	class _FlipIterator final: public _FlipConstIterator<T, Dir>
+	{
+		template<typename, typename>
+		friend class ::dl_reversible_list;
+	private:
+		using _BaseT      = _FlipConstIterator<T, Dir>;
+	public:
+		using value_type  = T;
+
+	public:
+		inline _FlipIterator()                     = default;
+		inline _FlipIterator(_FlipIterator const&) = default;
+		inline _FlipIterator(_FlipIterator&&)      = default;
+
+		template<int OtherDir, typename = std::enable_if_t<Dir == -1 && OtherDir != -1>>
+		inline _FlipIterator(_FlipIterator<T, OtherDir> const& p_other) noexcept: _BaseT(p_other) {}
+
+		inline _FlipIterator& operator = (_FlipIterator const& p_other) noexcept = default;
+		inline _FlipIterator& operator = (_FlipIterator&& p_other) noexcept = default;
+
+		inline _FlipIterator& operator ++()
+		{
+			_BaseT::operator++();
+			return *this;
+		}
+		inline _FlipIterator operator ++(int)
+		{
+			_FlipIterator temp = *this;
+			_BaseT::operator++();
+			return temp;
+		}
+
+		inline _FlipIterator& operator --()
+		{
+			_BaseT::operator--();
+			return *this;
+		}
+
+		inline _FlipIterator operator --(int)
+		{
+			_FlipIterator temp = *this;
+			_BaseT::operator--();
+			return temp;
+		}
+
+		[[nodiscard]] value_type& operator*() const noexcept
+		{
+			return _BaseT::_container->obj;
+		}
+
+		[[nodiscard]] value_type* operator->() const noexcept
+		{
+			return &(_BaseT::_container->obj);
+		}
+
+	private:
+		_FlipIterator(_FlipContainer<T>* const pos, uint8_t const p_dir): _BaseT(pos, p_dir) {}
+	};
+
+} //namespace _p
+
+
+///	\brief Doubly linked list whose orientation is a flag, making reverse() O(1).
+///	\details Nodes keep their two links in an array indexed by direction, so begin(), end(), push_front(), push_back()
+///		and iteration all follow the current orientation with an indexed load instead of a branch.
+///		For tight loops, visit() dispatches on the orientation once and hands out iterators whose direction
+///		is fixed at compile time.
+template<typename T, typename NodeAllocator>
+class dl_reversible_list
+{
+public:
+	using value_type      = T;
+	using allocator_type  = NodeAllocator;
+	using size_type       = uintptr_t;
+	using reference       = value_type&;
+	using const_reference = value_type const&;
+
+	using iterator               = _p::_FlipIterator     <value_type, -1>;
+	using const_iterator         = _p::_FlipConstIterator<value_type, -1>;
+	using reverse_iterator       = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	template<int Dir>
+	using fixed_iterator       = _p::_FlipIterator     <value_type, Dir>;
+	template<int Dir>
+	using fixed_const_iterator = _p::_FlipConstIterator<value_type, Dir>;
+
+	using _Container_t = _p::_FlipContainer<value_type>;
+
+public:
+	inline dl_reversible_list() = default;
+
+	template<typename... AllocArgs>
+	inline explicit dl_reversible_list(std::in_place_t, AllocArgs&&... p_alloc_args): _alloc(std::forward<AllocArgs>(p_alloc_args)...) {}
+
+	dl_reversible_list(dl_reversible_list const&)             = delete;
+	dl_reversible_list& operator = (dl_reversible_list const&) = delete;
+
+	~dl_reversible_list()
+	{
+		_release(__end.link[0]);
+	}
+
+	[[nodiscard]] inline iterator               begin  ()       noexcept { return iterator      {__end.link[_dir], _dir}; }
+	[[nodiscard]] inline const_iterator         begin  () const noexcept { return const_iterator{__end.link[_dir], _dir}; }
+	[[nodiscard]] inline const_iterator         cbegin () const noexcept { return const_iterator{__end.link[_dir], _dir}; }
+
+	[[nodiscard]] inline iterator               end    ()       noexcept { return iterator      {_end_p(), _dir}; }
+	[[nodiscard]] inline const_iterator         end    () const noexcept { return const_iterator{_end_p(), _dir}; }
+	[[nodiscard]] inline const_iterator         cend   () const noexcept { return const_iterator{_end_p(), _dir}; }
+
+	[[nodiscard]] inline reverse_iterator       rbegin ()       noexcept { return reverse_iterator(end()); }
+	[[nodiscard]] inline const_reverse_iterator rbegin () const noexcept { return const_reverse_iterator(cend()); }
+	[[nodiscard]] inline const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+
+	[[nodiscard]] inline reverse_iterator       rend   ()       noexcept { return reverse_iterator(begin()); }
+	[[nodiscard]] inline const_reverse_iterator rend   () const noexcept { return const_reverse_iterator(cbegin()); }
+	[[nodiscard]] inline const_reverse_iterator crend  () const noexcept { return const_reverse_iterator(cbegin()); }
+
+	[[nodiscard]] inline bool                   empty  () const noexcept { return __end.link[0] == _end_p(); }
+
+	[[nodiscard]] inline allocator_type&        get_allocator()       noexcept { return _alloc; }
+	[[nodiscard]] inline allocator_type const&  get_allocator() const noexcept { return _alloc; }
+
+	///	\brief Flips the orientation of the list, O(1).
+	///	\note Iterators stay valid but keep walking in the orientation they were obtained with.
+	inline void reverse() noexcept { _dir ^= 1; }
+
+	///	\brief True if the list is currently walked against its original orientation.
+	[[nodiscard]] inline bool reversed() const noexcept { return _dir != 0; }
+
+	///	\brief Calls \p p_func(first, last) with iterators whose direction is fixed at compile time.
+	template<typename Func>
+	decltype(auto) visit(Func&& p_func)
+	{
+		if(_dir)
+		{
+			return std::forward<Func>(p_func)(fixed_iterator<1>{__end.link[1], 1}, fixed_iterator<1>{_end_p(), 1});
+		}
+		return std::forward<Func>(p_func)(fixed_iterator<0>{__end.link[0], 0}, fixed_iterator<0>{_end_p(), 0});
+	}
+
+	template<typename Func>
+	decltype(auto) visit(Func&& p_func) const
+	{
+		if(_dir)
+		{
+			return std::forward<Func>(p_func)(fixed_const_iterator<1>{__end.link[1], 1}, fixed_const_iterator<1>{_end_p(), 1});
+		}
+		return std::forward<Func>(p_func)(fixed_const_iterator<0>{__end.link[0], 0}, fixed_const_iterator<0>{_end_p(), 0});
+	}
+
+	void clear() noexcept
+	{
+		_Container_t* const end_p = _end_p();
+		_Container_t* const pivot = __end.link[0];
+		__end.link[0] = end_p;
+		__end.link[1] = end_p;
+		_release(pivot);
+	}
+
+	template< class... Args >
+	iterator emplace(const_iterator pos, Args&&... args)
+	{
+		uint8_t const fwd = _dir;
+		uint8_t const bwd = fwd ^ 1;
+		_Container_t* const next = pos._container;
+		_Container_t* const prev = next->link[bwd];
+		_Container_t* const container = _new_node(std::forward<Args>(args)...);
+
+		next     ->link[bwd] = container;
+		prev     ->link[fwd] = container;
+		container->link[fwd] = next;
+		container->link[bwd] = prev;
+
+		return iterator{container, fwd};
+	}
+
+	iterator insert(const_iterator const pos, const value_type& value)
+	{
+		return emplace(pos, value);
+	}
+
+	iterator insert(const_iterator const pos, value_type&& value)
+	{
+		return emplace(pos, std::move(value));
+	}
+
+	iterator erase(const_iterator const pos)
+	{
+		uint8_t const fwd = _dir;
+		uint8_t const bwd = fwd ^ 1;
+		_Container_t* const container = pos._container;
+		_Container_t* const prev      = container->link[bwd];
+		_Container_t* const next      = container->link[fwd];
+		prev->link[fwd] = next;
+		next->link[bwd] = prev;
+		_delete_node(container);
+
+		return iterator{next, fwd};
+	}
+
+	iterator erase(const_iterator const first, const_iterator const last)
+	{
+		uint8_t const fwd = _dir;
+		uint8_t const bwd = fwd ^ 1;
+		_Container_t* const prev      = first._container->link[bwd];
+		_Container_t* const last_p    = last._container;
+		prev  ->link[fwd] = last_p;
+		last_p->link[bwd] = prev;
+
+		_Container_t* pivot = first._container;
+		while(pivot != last_p)
+		{
+			_Container_t* const delete_me = pivot;
+			pivot = pivot->link[fwd];
+			_delete_node(delete_me);
+		}
+
+		return iterator{last_p, fwd};
+	}
+
+	void push_back(const value_type& value)
+	{
+		emplace(end(), value);
+	}
+
+	void push_back(value_type&& value)
+	{
+		emplace(end(), std::move(value));
+	}
+
+	void pop_back()
+	{
+		uint8_t const fwd = _dir;
+		uint8_t const bwd = fwd ^ 1;
+		_Container_t* const container = __end.link[bwd];
+		_Container_t* const prev = container->link[bwd];
+		prev->link[fwd] = _end_p();
+		__end.link[bwd] = prev;
+		_delete_node(container);
+	}
+
+	void push_front(const value_type& value)
+	{
+		emplace(begin(), value);
+	}
+
+	void push_front(value_type&& value)
+	{
+		emplace(begin(), std::move(value));
+	}
+
+	void pop_front()
+	{
+		uint8_t const fwd = _dir;
+		uint8_t const bwd = fwd ^ 1;
+		_Container_t* const container = __end.link[fwd];
+		_Container_t* const next = container->link[fwd];
+		next->link[bwd] = _end_p();
+		__end.link[fwd] = next;
+		_delete_node(container);
+	}
+
+private:
+	[[nodiscard]] inline _Container_t* _end_p() const
+	{
+		return const_cast<_Container_t* const>(static_cast<_Container_t const* const>(&__end));
+	}
+
+	void _release(_Container_t* pivot) noexcept
+	{
+		_Container_t* const end_p = _end_p();
+		while(pivot != end_p)
+		{
+			_Container_t* const delete_me = pivot;
+			pivot = pivot->link[0];
+			_delete_node(delete_me);
+		}
+	}
+
+	template< class... Args >
+	[[nodiscard]] _Container_t* _new_node(Args&&... args)
+	{
+		void* const mem = _alloc.template allocate<_Container_t>();
+		try
+		{
+			return new (mem) _Container_t(std::forward<Args>(args)...);
+		}
+		catch(...)
+		{
+			_alloc.template deallocate<_Container_t>(mem);
+			throw;
+		}
+	}
+
+	inline void _delete_node(_Container_t* const p_node) noexcept
+	{
+		p_node->~_Container_t();
+		_alloc.template deallocate<_Container_t>(p_node);
+	}
+
+	_p::_FlipContainerHeader<value_type> __end;
+	uint8_t _dir = 0;
+	[[no_unique_address]] allocator_type _alloc;
+};
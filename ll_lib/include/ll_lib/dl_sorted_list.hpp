@@ -0,0 +1,601 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "ll_lib.hpp"
+
+template<typename T, typename Compare, bool SkipIndex>
+class dl_sorted_list;
+
+namespace _p
+{
+	template<typename T, bool SkipIndex>
+	struct _SortedNode;
+
+	template<typename T>
+	struct _SkipTower;
+
+	///	\brief Express lane link, reads are counted as node hops under LL_LIB_TRACE_HOPS.
+	template<typename T>
+	struct _SkipLink
+	{
+	public:
+		[[nodiscard]] inline _SkipTower<T>* next() const noexcept { _LL_NODE_HOP(); return _next; }
+		[[nodiscard]] inline _SkipTower<T>* prev() const noexcept { _LL_NODE_HOP(); return _prev; }
+
+		inline void set_next(_SkipTower<T>* const p_next) noexcept { _next = p_next; }
+		inline void set_prev(_SkipTower<T>* const p_prev) noexcept { _prev = p_prev; }
+
+	private:
+		_SkipTower<T>* _next;
+		_SkipTower<T>* _prev;
+	};
+
+	///	\brief Express lane entry of a sorted list element.
+	///	\note Allocated in a single block, the \p height links follow the header.
+	template<typename T>
+	struct _SkipTower
+	{
+		using _BaseIt = _ConstIterator<_SortedNode<T, true>>;
+
+		[[nodiscard]] inline _SkipLink<T>* links() noexcept { return reinterpret_cast<_SkipLink<T>*>(this + 1); }
+
+		_BaseIt base;
+		uintptr_t height;
+	};
+
+	template<typename T, bool SkipIndex>
+	struct _SortedNode
+	{
+		T obj;
+	};
+
+	template<typename T>
+	struct _SortedNode<T, true>
+	{
+		T obj;
+		_SkipTower<T>* tower;
+	};
+
+	template<typename T, bool SkipIndex>
+	class _SortedConstIterator
+	{
+		template<typename, typename, bool>
+		friend class ::dl_sorted_list;
+	private:
+		using _BaseIt = _ConstIterator<_SortedNode<T, SkipIndex>>;
+
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type      = T;
+		using difference_type = intptr_t;
+		using pointer         = value_type const*;
+		using reference       = value_type const&;
+
+	public:
+		inline _SortedConstIterator()                            = default;
+		inline _SortedConstIterator(_SortedConstIterator const&) = default;
+		inline _SortedConstIterator(_SortedConstIterator&&)      = default;
+
+		inline _SortedConstIterator& operator = (_SortedConstIterator const&) = default;
+		inline _SortedConstIterator& operator = (_SortedConstIterator&&)      = default;
+
+	public:
+		[[nodiscard]] inline bool operator == (_SortedConstIterator const& p_other) const noexcept { return p_other._it == _it; }
+
+		inline _SortedConstIterator& operator ++()
+		{
+			++_it;
+			return *this;
+		}
+
+		inline _SortedConstIterator operator ++(int)
+		{
+			_SortedConstIterator temp = *this;
+			++_it;
+			return temp;
+		}
+
+		inline _SortedConstIterator& operator --()
+		{
+			--_it;
+			return *this;
+		}
+
+		inline _SortedConstIterator operator --(int)
+		{
+			_SortedConstIterator temp = *this;
+			--_it;
+			return temp;
+		}
+
+		[[nodiscard]] value_type const& operator*() const noexcept
+		{
+			return _it->obj;
+		}
+
+		[[nodiscard]] value_type const* operator->() const noexcept
+		{
+			return &(_it->obj);
+		}
+
+	private:
+		inline _SortedConstIterator(_BaseIt const pos) noexcept: _it(pos) {}
+		_BaseIt _it;
+	};
+
+} //namespace _p
+
+
+///	\brief Doubly linked list kept in \p Compare order.
+///	\details Remembers the position of the last insertion, erasure or lookup (the finger) and searches outward from it,
+///		so nearly in-order streams insert, and sequential scans look up, in amortized O(1).
+///		Only lookups on a non-const list move the finger, they modify the list and must not run concurrently.
+///		Lookups through a const reference search from the finger without moving it and can run concurrently,
+///		at the cost of losing the locality of the previous lookup.
+///		Equal elements are kept in insertion order.
+///	\tparam SkipIndex - When true, elements are also indexed by randomized express lanes (skip list),
+///		bounding insert, lower_bound and erase(key) to expected O(log n) when the finger is far away.
+template<typename T, typename Compare = std::less<T>, bool SkipIndex = false>
+class dl_sorted_list
+{
+public:
+	using value_type      = T;
+	using size_type       = uintptr_t;
+	using reference       = value_type&;
+	using const_reference = value_type const&;
+	using key_compare     = Compare;
+
+	using const_iterator         = _p::_SortedConstIterator<value_type, SkipIndex>;
+	using iterator               = const_iterator;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+	using reverse_iterator       = const_reverse_iterator;
+
+private:
+	using _Node_t   = _p::_SortedNode<value_type, SkipIndex>;
+	using _Base_t   = dl_list<_Node_t>;
+	using _BaseIt_t = typename _Base_t::const_iterator;
+	using _Tower_t  = _p::_SkipTower<value_type>;
+	using _Link_t   = _p::_SkipLink<value_type>;
+
+	///	\brief Number of hops the finger is allowed to travel before falling back to the skip index.
+	static constexpr uintptr_t finger_probe_limit = SkipIndex ? 8 : static_cast<uintptr_t>(-1);
+	static constexpr uintptr_t max_height = 16;
+
+public:
+	inline dl_sorted_list() : _finger{_list.cend()}
+	{
+		if constexpr(SkipIndex)
+		{
+			_head_init();
+		}
+	}
+
+	inline explicit dl_sorted_list(Compare const& p_comp) : _comp{p_comp}, _finger{_list.cend()}
+	{
+		if constexpr(SkipIndex)
+		{
+			_head_init();
+		}
+	}
+
+	dl_sorted_list(dl_sorted_list const&)             = delete;
+	dl_sorted_list& operator = (dl_sorted_list const&) = delete;
+
+	~dl_sorted_list()
+	{
+		if constexpr(SkipIndex)
+		{
+			_clear_towers();
+		}
+	}
+
+	[[nodiscard]] inline const_iterator         begin  () const noexcept { return const_iterator{_list.cbegin()}; }
+	[[nodiscard]] inline const_iterator         cbegin () const noexcept { return const_iterator{_list.cbegin()}; }
+
+	[[nodiscard]] inline const_iterator         end    () const noexcept { return const_iterator{_list.cend()}; }
+	[[nodiscard]] inline const_iterator         cend   () const noexcept { return const_iterator{_list.cend()}; }
+
+	[[nodiscard]] inline const_reverse_iterator rbegin () const noexcept { return const_reverse_iterator(cend()); }
+	[[nodiscard]] inline const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+
+	[[nodiscard]] inline const_reverse_iterator rend   () const noexcept { return const_reverse_iterator(cbegin()); }
+	[[nodiscard]] inline const_reverse_iterator crend  () const noexcept { return const_reverse_iterator(cbegin()); }
+
+	[[nodiscard]] inline bool                   empty  () const noexcept { return _list.empty(); }
+
+	void clear() noexcept
+	{
+		if constexpr(SkipIndex)
+		{
+			_clear_towers();
+		}
+		_list.clear();
+		_finger = _list.cend();
+	}
+
+	iterator insert(const value_type& value)
+	{
+		return _insert(value_type(value));
+	}
+
+	iterator insert(value_type&& value)
+	{
+		return _insert(std::move(value));
+	}
+
+	///	\brief Inserts using \p hint as the starting point of the search.
+	iterator insert(const_iterator const hint, const value_type& value)
+	{
+		_finger = hint._it;
+		return _insert(value_type(value));
+	}
+
+	iterator insert(const_iterator const hint, value_type&& value)
+	{
+		_finger = hint._it;
+		return _insert(std::move(value));
+	}
+
+	template< class... Args >
+	iterator emplace(Args&&... args)
+	{
+		return _insert(value_type(std::forward<Args>(args)...));
+	}
+
+	[[nodiscard]] const_iterator lower_bound(const value_type& key) const
+	{
+		return const_iterator{_search<false>(key)};
+	}
+
+	///	\brief Same as the const overload, also moves the finger to the result.
+	[[nodiscard]] const_iterator lower_bound(const value_type& key)
+	{
+		_finger = _search<false>(key);
+		return const_iterator{_finger};
+	}
+
+	[[nodiscard]] const_iterator upper_bound(const value_type& key) const
+	{
+		return const_iterator{_search<true>(key)};
+	}
+
+	///	\brief Same as the const overload, also moves the finger to the result.
+	[[nodiscard]] const_iterator upper_bound(const value_type& key)
+	{
+		_finger = _search<true>(key);
+		return const_iterator{_finger};
+	}
+
+	[[nodiscard]] const_iterator find(const value_type& key) const
+	{
+		return _find(_search<false>(key), key);
+	}
+
+	///	\brief Same as the const overload, also moves the finger to the lower bound of \p key.
+	[[nodiscard]] const_iterator find(const value_type& key)
+	{
+		_finger = _search<false>(key);
+		return _find(_finger, key);
+	}
+
+	iterator erase(const_iterator const pos)
+	{
+		return const_iterator{_erase(pos._it)};
+	}
+
+	///	\brief Erases all elements equivalent to \p key.
+	///	\return Number of elements erased.
+	size_type erase(const value_type& key)
+	{
+		_BaseIt_t it = _search<false>(key);
+		_finger = it;
+		size_type count = 0;
+		while(it != _list.cend() && !_comp(key, it->obj))
+		{
+			it = _erase(it);
+			++count;
+		}
+		return count;
+	}
+
+private:
+	///	\brief Moves the finger towards the first element for which the search predicate is false.
+	///	\details The predicate is "element < key" for lower bound and "!(key < element)" for upper bound.
+	///	\return false if the position could not be reached within \ref finger_probe_limit hops.
+	template<bool Upper>
+	[[nodiscard]] bool _finger_seek(const value_type& key, _BaseIt_t& p_out) const
+	{
+		_BaseIt_t const begin_it = _list.cbegin();
+		_BaseIt_t const end_it   = _list.cend();
+		_BaseIt_t it = _finger;
+		uintptr_t hops = finger_probe_limit;
+
+		if(it != end_it && _before<Upper>(it->obj, key))
+		{
+			do
+			{
+				if(!hops--) return false;
+				++it;
+			}
+			while(it != end_it && _before<Upper>(it->obj, key));
+		}
+		else
+		{
+			while(it != begin_it)
+			{
+				_BaseIt_t prev = it;
+				--prev;
+				if(_before<Upper>(prev->obj, key)) break;
+				if(!hops--) return false;
+				it = prev;
+			}
+		}
+
+		p_out = it;
+		return true;
+	}
+
+	///	\brief Finds the first element for which the search predicate is false, leaves the finger in place.
+	template<bool Upper>
+	[[nodiscard]] _BaseIt_t _search(const value_type& key) const
+	{
+		_BaseIt_t it;
+		if(_finger_seek<Upper>(key, it))
+		{
+			return it;
+		}
+		if constexpr(SkipIndex)
+		{
+			it = _descend<Upper>(key, nullptr);
+		}
+		return it;
+	}
+
+	///	\brief Searches from the head of the skip index.
+	///	\param[out] p_preds - If not null, receives the rightmost tower preceding the position on each level.
+	template<bool Upper>
+	[[nodiscard]] _BaseIt_t _descend(const value_type& key, _Tower_t** const p_preds) const
+	{
+		static_assert(SkipIndex, "only the finger is available without the skip index");
+
+		_Tower_t* const head = _head_p();
+		_Tower_t* pivot = head;
+		for(uintptr_t level = max_height; level--;)
+		{
+			for(_Tower_t* next = pivot->links()[level].next();
+				next != head && _before<Upper>(next->base->obj, key);
+				next = pivot->links()[level].next())
+			{
+				pivot = next;
+			}
+			if(p_preds) p_preds[level] = pivot;
+		}
+
+		_BaseIt_t it = (pivot == head) ? _list.cbegin() : pivot->base;
+		_BaseIt_t const end_it = _list.cend();
+		while(it != end_it && _before<Upper>(it->obj, key))
+		{
+			++it;
+		}
+		return it;
+	}
+
+	///	\brief Collects the rightmost tower preceding \p p_pos on each of the \p p_height lowest levels.
+	///	\details Walks back to the closest indexed element, then climbs one level at a time.
+	///		A tower reaches the next level with p = 1/4, so each step is expected O(1).
+	void _climb(_BaseIt_t const p_pos, uintptr_t const p_height, _Tower_t** const p_preds) const
+	{
+		_Tower_t* pivot = _head_p();
+		_BaseIt_t const begin_it = _list.cbegin();
+		for(_BaseIt_t it = p_pos; it != begin_it;)
+		{
+			--it;
+			if(it->tower)
+			{
+				pivot = it->tower;
+				break;
+			}
+		}
+
+		for(uintptr_t level = 0; level < p_height; ++level)
+		{
+			while(pivot->height <= level)
+			{
+				pivot = pivot->links()[level - 1].prev();
+			}
+			p_preds[level] = pivot;
+		}
+	}
+
+	[[nodiscard]] const_iterator _find(_BaseIt_t const p_lower, const value_type& key) const
+	{
+		if(p_lower != _list.cend() && !_comp(key, p_lower->obj))
+		{
+			return const_iterator{p_lower};
+		}
+		return cend();
+	}
+
+	iterator _insert(value_type&& value)
+	{
+		if constexpr(SkipIndex)
+		{
+			uintptr_t const height = _random_height();
+			if(height)
+			{
+				_Tower_t* preds[max_height];
+				_BaseIt_t pos;
+				if(_finger_seek<true>(value, pos))
+				{
+					_climb(pos, height, preds);
+				}
+				else
+				{
+					pos = _descend<true>(value, preds);
+				}
+
+				_Tower_t* const tower = _make_tower(height);
+				_BaseIt_t it;
+				try
+				{
+					it = _list.emplace(pos, std::move(value), tower);
+				}
+				catch(...)
+				{
+					_free_tower(tower);
+					throw;
+				}
+
+				tower->base = it;
+				for(uintptr_t level = 0; level < height; ++level)
+				{
+					_Link_t& pred_link = preds[level]->links()[level];
+					_Link_t& link = tower->links()[level];
+					_Tower_t* const next = pred_link.next();
+					link.set_prev(preds[level]);
+					link.set_next(next);
+					next->links()[level].set_prev(tower);
+					pred_link.set_next(tower);
+				}
+				_finger = it;
+				return const_iterator{it};
+			}
+		}
+
+		_BaseIt_t const pos = _search<true>(value);
+		_BaseIt_t it;
+		if constexpr(SkipIndex)
+		{
+			it = _list.emplace(pos, std::move(value), nullptr);
+		}
+		else
+		{
+			it = _list.emplace(pos, std::move(value));
+		}
+		_finger = it;
+		return const_iterator{it};
+	}
+
+	_BaseIt_t _erase(_BaseIt_t const pos)
+	{
+		if constexpr(SkipIndex)
+		{
+			_Tower_t* const tower = pos->tower;
+			if(tower)
+			{
+				for(uintptr_t level = 0; level < tower->height; ++level)
+				{
+					_Link_t& link = tower->links()[level];
+					_Tower_t* const prev = link.prev();
+					_Tower_t* const next = link.next();
+					prev->links()[level].set_next(next);
+					next->links()[level].set_prev(prev);
+				}
+				_free_tower(tower);
+			}
+		}
+
+		_BaseIt_t const next = _list.erase(pos);
+		_finger = next;
+		return next;
+	}
+
+	template<bool Upper>
+	[[nodiscard]] inline bool _before(const value_type& p_element, const value_type& p_key) const
+	{
+		if constexpr(Upper)
+		{
+			return !_comp(p_key, p_element);
+		}
+		else
+		{
+			return _comp(p_element, p_key);
+		}
+	}
+
+	///	\brief Geometric distribution with p = 1/4, 0 means the element is not indexed.
+	[[nodiscard]] uintptr_t _random_height() noexcept
+	{
+		_rng ^= _rng << 13;
+		_rng ^= _rng >> 7;
+		_rng ^= _rng << 17;
+		uint64_t bits = _rng;
+		uintptr_t height = 0;
+		while((bits & 3) == 0 && height < max_height)
+		{
+			++height;
+			bits >>= 2;
+		}
+		return height;
+	}
+
+	[[nodiscard]] static _Tower_t* _make_tower(uintptr_t const p_height)
+	{
+		void* const mem = ::operator new(sizeof(_Tower_t) + p_height * sizeof(_Link_t));
+		return new (mem) _Tower_t{_BaseIt_t{}, p_height};
+	}
+
+	static void _free_tower(_Tower_t* const p_tower) noexcept
+	{
+		p_tower->~_Tower_t();
+		::operator delete(p_tower);
+	}
+
+	void _clear_towers() noexcept
+	{
+		_Tower_t* const head = _head_p();
+		_Tower_t* pivot = head->links()[0].next();
+		while(pivot != head)
+		{
+			_Tower_t* const delete_me = pivot;
+			pivot = pivot->links()[0].next();
+			_free_tower(delete_me);
+		}
+		_head_init();
+	}
+
+	void _head_init() noexcept
+	{
+		_Tower_t* const head = _head_p();
+		head->height = max_height;
+		for(_Link_t& link : _head.links)
+		{
+			link.set_next(head);
+			link.set_prev(head);
+		}
+	}
+
+	struct _HeadTower
+	{
+		_Tower_t tower;
+		_Link_t links[max_height];
+	};
+
+	struct _NoHead {};
+
+	[[nodiscard]] inline _Tower_t* _head_p() const noexcept
+	{
+		static_assert(offsetof(_HeadTower, links) == sizeof(_Tower_t));
+		return const_cast<_Tower_t*>(&_head.tower);
+	}
+
+	_Base_t _list;
+	[[no_unique_address]] Compare _comp;
+	_BaseIt_t _finger;
+	[[no_unique_address]] std::conditional_t<SkipIndex, _HeadTower, _NoHead> _head;
+	uint64_t _rng = 0x9E3779B97F4A7C15;
+};
@@ -0,0 +1,403 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "ll_lib.hpp"
+
+template<typename T, typename NodeAllocator = dl_heap_node_allocator>
+class dl_xor_list;
+
+namespace _p
+{
+	template<typename T>
+	struct _XorContainer;
+
+	///	\brief Single link word, holds the address of the previous node xor the address of the next one.
+	template<typename T>
+	struct _XorContainerHeader
+	{
+	public:
+		inline _XorContainerHeader(): link(0) {}
+
+		[[nodiscard]] inline _XorContainer<T>* other(_XorContainer<T> const* const p_neighbour) const noexcept
+		{
+			return reinterpret_cast<_XorContainer<T>*>(link ^ reinterpret_cast<uintptr_t>(p_neighbour));
+		}
+
+		///	\brief Replaces neighbour \p p_old with \p p_new.
+		inline void relink(_XorContainer<T> const* const p_old, _XorContainer<T> const* const p_new) noexcept
+		{
+			link ^= reinterpret_cast<uintptr_t>(p_old) ^ reinterpret_cast<uintptr_t>(p_new);
+		}
+
+		uintptr_t link;
+	};
+
+	template<typename T>
+	struct _XorContainer: public _XorContainerHeader<T>
+	{
+	public:
+		template <class... Args>
+		inline _XorContainer(Args&&... args) :_XorContainerHeader<T>(), obj{std::forward<Args>(args)...} {}
+
+		T obj;
+	};
+
+	///	\brief Iterators carry the current node and the one before it, needed to decode the link word.
+	template<typename T>
+	class _XorConstIterator
+	{
+		template<typename, typename>
+		friend class ::dl_xor_list;
+	protected:
+		using _NodePtr        = _XorContainer<T>*;
+
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type      = T;
+		using difference_type = intptr_t;
+		using pointer         = value_type*;
+		using reference       = value_type&;
+
+	public:
+		inline _XorConstIterator()                         = default;
+		inline _XorConstIterator(_XorConstIterator const&) = default;
+		inline _XorConstIterator(_XorConstIterator&&)      = default;
+
+	public:
+		[[nodiscard]] inline bool operator == (_XorConstIterator const& p_other) const noexcept { return p_other._container == _container; }
+
+		inline _XorConstIterator& operator = (_XorConstIterator const& p_other) noexcept = default;
+		inline _XorConstIterator& operator = (_XorConstIterator&& p_other) noexcept = default;
+
+		inline _XorConstIterator& operator ++()
+		{
+			_NodePtr const next = _container->other(_prev);
+			_prev = _container;
+			_container = next;
+			return *this;
+		}
+
+		inline _XorConstIterator operator ++(int)
+		{
+			_XorConstIterator temp = *this;
+			operator ++();
+			return temp;
+		}
+
+		inline _XorConstIterator& operator --()
+		{
+			_NodePtr const prev = _prev->other(_container);
+			_container = _prev;
+			_prev = prev;
+			return *this;
+		}
+
+		inline _XorConstIterator operator --(int)
+		{
+			_XorConstIterator temp = *this;
+			operator --();
+			return temp;
+		}
+
+		[[nodiscard]] value_type const& operator*() const noexcept
+		{
+			return _container->obj;
+		}
+
+		[[nodiscard]] value_type const* operator->() const noexcept
+		{
+			return &(_container->obj);
+		}
+
+	protected:
+		inline _XorConstIterator(_NodePtr const p_prev, _NodePtr const pos) noexcept: _prev(p_prev), _container(pos) {}
+		_NodePtr _prev      = nullptr;
+		_NodePtr _container = nullptr;
+	};
+
+	template<typename T>
+	class _XorIterator final: public _XorConstIterator<T>
+	{
+		template<typename, typename>
+		friend class ::dl_xor_list;
+	private:
+		using _BaseT      = _XorConstIterator<T>;
+	public:
+		using value_type  = T;
+
+	public:
+		inline _XorIterator()                    = default;
+		inline _XorIterator(_XorIterator const&) = default;
+		inline _XorIterator(_XorIterator&&)      = default;
+
+		inline _XorIterator& operator = (_XorIterator const& p_other) noexcept = default;
+		inline _XorIterator& operator = (_XorIterator&& p_other) noexcept = default;
+
+		inline _XorIterator& operator ++()
+		{
+			_BaseT::operator++();
+			return *this;
+		}
+		inline _XorIterator operator ++(int)
+		{
+			_XorIterator temp = *this;
+			_BaseT::operator++();
+			return temp;
+		}
+
+		inline _XorIterator& operator --()
+		{
+			_BaseT::operator--();
+			return *this;
+		}
+
+		inline _XorIterator operator --(int)
+		{
+			_XorIterator temp = *this;
+			_BaseT::operator--();
+			return temp;
+		}
+
+		[[nodiscard]] value_type& operator*() const noexcept
+		{
+			return _BaseT::_container->obj;
+		}
+
+		[[nodiscard]] value_type* operator->() const noexcept
+		{
+			return &(_BaseT::_container->obj);
+		}
+
+	private:
+		_XorIterator(_XorContainer<T>* const p_prev, _XorContainer<T>* const pos): _BaseT(p_prev, pos) {}
+	};
+
+} //namespace _p
+
+
+///	\brief Doubly linked list storing a single "prev xor next" word per node.
+///	\details Saves one pointer per node compared to dl_list, at the cost of iterators holding two pointers
+///		and every step decoding the link word.
+///	\warning Inserting or erasing an element invalidates iterators to its neighbours, not only to itself.
+template<typename T, typename NodeAllocator>
+class dl_xor_list
+{
+public:
+	using value_type      = T;
+	using allocator_type  = NodeAllocator;
+	using size_type       = uintptr_t;
+	using reference       = value_type&;
+	using const_reference = value_type const&;
+
+	using iterator               = _p::_XorIterator     <value_type>;
+	using const_iterator         = _p::_XorConstIterator<value_type>;
+	using reverse_iterator       = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	using _Container_t = _p::_XorContainer<value_type>;
+
+public:
+	inline dl_xor_list() = default;
+
+	template<typename... AllocArgs>
+	inline explicit dl_xor_list(std::in_place_t, AllocArgs&&... p_alloc_args): _alloc(std::forward<AllocArgs>(p_alloc_args)...) {}
+
+	dl_xor_list(dl_xor_list const&)             = delete;
+	dl_xor_list& operator = (dl_xor_list const&) = delete;
+
+	~dl_xor_list()
+	{
+		if constexpr(_bulk_teardown)
+		{
+			_alloc.reset();
+		}
+		else
+		{
+			_release();
+		}
+	}
+
+	[[nodiscard]] inline iterator               begin  ()       noexcept { return iterator      {_end_p(), _first()}; }
+	[[nodiscard]] inline const_iterator         begin  () const noexcept { return const_iterator{_end_p(), _first()}; }
+	[[nodiscard]] inline const_iterator         cbegin () const noexcept { return const_iterator{_end_p(), _first()}; }
+
+	[[nodiscard]] inline iterator               end    ()       noexcept { return iterator      {_last(), _end_p()}; }
+	[[nodiscard]] inline const_iterator         end    () const noexcept { return const_iterator{_last(), _end_p()}; }
+	[[nodiscard]] inline const_iterator         cend   () const noexcept { return const_iterator{_last(), _end_p()}; }
+
+	[[nodiscard]] inline reverse_iterator       rbegin ()       noexcept { return reverse_iterator(end()); }
+	[[nodiscard]] inline const_reverse_iterator rbegin () const noexcept { return const_reverse_iterator(cend()); }
+	[[nodiscard]] inline const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator(cend()); }
+
+	[[nodiscard]] inline reverse_iterator       rend   ()       noexcept { return reverse_iterator(begin()); }
+	[[nodiscard]] inline const_reverse_iterator rend   () const noexcept { return const_reverse_iterator(cbegin()); }
+	[[nodiscard]] inline const_reverse_iterator crend  () const noexcept { return const_reverse_iterator(cbegin()); }
+
+	[[nodiscard]] inline bool                   empty  () const noexcept { return __first == _end_p(); }
+
+	[[nodiscard]] inline allocator_type&        get_allocator()       noexcept { return _alloc; }
+	[[nodiscard]] inline allocator_type const&  get_allocator() const noexcept { return _alloc; }
+
+	void clear() noexcept
+	{
+		if constexpr(_bulk_teardown)
+		{
+			_alloc.reset();
+		}
+		else
+		{
+			_release();
+		}
+		__end.link = 0;
+		__first = _end_p();
+	}
+
+	template< class... Args >
+	iterator emplace(const_iterator const pos, Args&&... args)
+	{
+		_Container_t* const prev = pos._prev;
+		_Container_t* const next = pos._container;
+		_Container_t* const container = _new_node(std::forward<Args>(args)...);
+
+		container->link = reinterpret_cast<uintptr_t>(prev) ^ reinterpret_cast<uintptr_t>(next);
+		prev->relink(next, container);
+		next->relink(prev, container);
+		if(prev == _end_p())
+		{
+			__first = container;
+		}
+
+		return iterator{prev, container};
+	}
+
+	iterator insert(const_iterator const pos, const value_type& value)
+	{
+		return emplace(pos, value);
+	}
+
+	iterator insert(const_iterator const pos, value_type&& value)
+	{
+		return emplace(pos, std::move(value));
+	}
+
+	iterator erase(const_iterator const pos)
+	{
+		_Container_t* const prev      = pos._prev;
+		_Container_t* const container = pos._container;
+		_Container_t* const next      = container->other(prev);
+
+		prev->relink(container, next);
+		next->relink(container, prev);
+		if(prev == _end_p())
+		{
+			__first = next;
+		}
+		_delete_node(container);
+
+		return iterator{prev, next};
+	}
+
+	iterator erase(const_iterator first, const_iterator const last)
+	{
+		while(first._container != last._container)
+		{
+			first = erase(first);
+		}
+		return iterator{first._prev, first._container};
+	}
+
+	void push_back(const value_type& value)
+	{
+		emplace(end(), value);
+	}
+
+	void push_back(value_type&& value)
+	{
+		emplace(end(), std::move(value));
+	}
+
+	void pop_back()
+	{
+		erase(--end());
+	}
+
+	void push_front(const value_type& value)
+	{
+		emplace(begin(), value);
+	}
+
+	void push_front(value_type&& value)
+	{
+		emplace(begin(), std::move(value));
+	}
+
+	void pop_front()
+	{
+		erase(begin());
+	}
+
+private:
+	static constexpr bool _bulk_teardown = std::is_trivially_destructible_v<value_type> && _p::_has_bulk_reset<allocator_type>;
+
+	[[nodiscard]] inline _Container_t* _end_p() const
+	{
+		return const_cast<_Container_t* const>(static_cast<_Container_t const* const>(&__end));
+	}
+
+	[[nodiscard]] inline _Container_t* _first() const noexcept { return __first; }
+	[[nodiscard]] inline _Container_t* _last () const noexcept { return __end.other(__first); }
+
+	template< class... Args >
+	[[nodiscard]] _Container_t* _new_node(Args&&... args)
+	{
+		void* const mem = _alloc.template allocate<_Container_t>();
+		try
+		{
+			return new (mem) _Container_t(std::forward<Args>(args)...);
+		}
+		catch(...)
+		{
+			_alloc.template deallocate<_Container_t>(mem);
+			throw;
+		}
+	}
+
+	inline void _delete_node(_Container_t* const p_node) noexcept
+	{
+		if constexpr(!std::is_trivially_destructible_v<value_type>)
+		{
+			p_node->~_Container_t();
+		}
+		_alloc.template deallocate<_Container_t>(p_node);
+	}
+
+	void _release() noexcept
+	{
+		_Container_t* const end_p = _end_p();
+		_Container_t* prev = end_p;
+		_Container_t* pivot = __first;
+		while(pivot != end_p)
+		{
+			_Container_t* const delete_me = pivot;
+			pivot = pivot->other(prev);
+			prev = delete_me;
+			_delete_node(delete_me);
+		}
+	}
+
+	_p::_XorContainerHeader<value_type> __end;
+	_Container_t* __first = _end_p();
+	[[no_unique_address]] allocator_type _alloc;
+};
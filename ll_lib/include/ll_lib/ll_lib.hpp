@@ -16,26 +16,106 @@ using dl_list = std::list<T>;
 
 #else //EASY_MODE
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <initializer_list>
 #include <iterator>
+#include <new>
+#include <type_traits>
 #include <utility>
 
+#ifdef LL_LIB_TRACE_HOPS
+//Counts every node link read, used by the tests to catch complexity regressions.
+//Must be defined for the whole binary, or not at all.
+namespace _p
+{
+	inline thread_local uintptr_t _node_hops = 0;
+}
+#	define _LL_NODE_HOP() (++::_p::_node_hops)
+#else
+#	define _LL_NODE_HOP() static_cast<void>(0)
+#endif
+
+///	\brief Opt-in trait for types that can be moved to a new address with memcpy, leaving the source dead.
+///	\details Defaults to trivially copyable types, specialize it for types like owning handles,
+///		whose move constructor + destructor pair is equivalent to a bitwise copy.
 template<typename T>
+struct dl_is_trivially_relocatable: std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+template<typename T>
+inline constexpr bool dl_is_trivially_relocatable_v = dl_is_trivially_relocatable<T>::value;
+
+///	\brief Default node allocation policy, every node is a separate heap allocation.
+///	\details A node allocation policy provides:
+///		- template<typename Node> void* allocate();
+///		- template<typename Node> void deallocate(void* p_node) noexcept;
+///		- NodeAllocator fresh() const; - an empty policy with the same configuration, used by copies and compact().
+///		- Optionally void reset() noexcept; - drops every node at once, used instead of per node deallocation
+///			when the nodes do not need destruction. It is also called before the policy is destroyed or replaced,
+///			so the policy's destructor and move assignment need not release nodes.
+///
+///		Each dl_list owns its own policy instance, so a policy only ever sees one \p Node type.
+struct dl_heap_node_allocator
+{
+	[[nodiscard]] inline dl_heap_node_allocator fresh() const noexcept { return {}; }
+
+	template<typename Node>
+	[[nodiscard]] inline void* allocate()
+	{
+		if constexpr(alignof(Node) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			return ::operator new(sizeof(Node), std::align_val_t{alignof(Node)});
+		}
+		else
+		{
+			return ::operator new(sizeof(Node));
+		}
+	}
+
+	template<typename Node>
+	inline void deallocate(void* const p_node) noexcept
+	{
+		if constexpr(alignof(Node) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+		{
+			::operator delete(p_node, std::align_val_t{alignof(Node)});
+		}
+		else
+		{
+			::operator delete(p_node);
+		}
+	}
+};
+
+template<typename T, typename NodeAllocator = dl_heap_node_allocator>
 class dl_list;
 
 namespace _p
 {
+	template<typename Alloc>
+	inline constexpr bool _has_bulk_reset = requires(Alloc& p_alloc) { p_alloc.reset(); };
+
 	template<typename T>
 	struct _Container;
 
+	///	\brief Node links.
+	///	\details Links are only read through next() and prev(), which count node hops under LL_LIB_TRACE_HOPS,
+	///		so no walk over the list can escape the count.
 	template<typename T>
 	struct _ContainerHeader
 	{
 	public:
 		_ContainerHeader();
-		_Container<T>* next;
-		_Container<T>* prev;
+
+		[[nodiscard]] inline _Container<T>* next() const noexcept { _LL_NODE_HOP(); return _next; }
+		[[nodiscard]] inline _Container<T>* prev() const noexcept { _LL_NODE_HOP(); return _prev; }
+
+		inline void set_next(_Container<T>* const p_next) noexcept { _next = p_next; }
+		inline void set_prev(_Container<T>* const p_prev) noexcept { _prev = p_prev; }
+
+	private:
+		_Container<T>* _next;
+		_Container<T>* _prev;
 	};
 
 	template<typename T>
@@ -49,20 +129,20 @@ namespace _p
 	};
 
 	template<typename T>
-	inline _ContainerHeader<T>::_ContainerHeader(): next(static_cast<_Container<T>*>(this)), prev(static_cast<_Container<T>*>(this)) {};
+	inline _ContainerHeader<T>::_ContainerHeader(): _next(static_cast<_Container<T>*>(this)), _prev(static_cast<_Container<T>*>(this)) {};
 
 
 	template<typename T>
 	class _ConstIterator
 	{
-		friend class dl_list<T>;
+		template<typename, typename>
+		friend class ::dl_list;
 	protected:
-		using _ParentList     = dl_list<T>;
 		using _NodePtr        = _Container<T>*;
 
 	public:
 		using iterator_category = std::bidirectional_iterator_tag;
-		using value_type      = typename _ParentList::value_type;
+		using value_type      = T;
 		using difference_type = intptr_t;
 		using pointer         = value_type*;
 		using reference       = value_type&;
@@ -80,27 +160,27 @@ namespace _p
 
 		inline _ConstIterator& operator ++()
 		{
-			_container = _container->next;
+			_container = _container->next();
 			return *this;
 		}
 
 		inline _ConstIterator operator ++(int)
 		{
 			_ConstIterator temp = *this;
-			_container = _container->next;
+			_container = _container->next();
 			return temp;
 		}
 
 		inline _ConstIterator& operator --()
 		{
-			_container = _container->prev;
+			_container = _container->prev();
 			return *this;
 		}
 
 		inline _ConstIterator operator --(int)
 		{
 			_ConstIterator temp = *this;
-			_container = _container->prev;
+			_container = _container->prev();
 			return temp;
 		}
 
@@ -122,12 +202,12 @@ namespace _p
 	template<typename T>
 	class _Iterator final: public _ConstIterator<T>
 	{
-		friend class dl_list<T>;
+		template<typename, typename>
+		friend class ::dl_list;
 	private:
 		using _BaseT      = _ConstIterator<T>;
-		using _ParentList = typename _BaseT::_ParentList;
 	public:
-		using value_type  = typename _ParentList::value_type;
+		using value_type  = T;
 
 	public:
 		inline _Iterator()                 = default;
@@ -179,11 +259,12 @@ namespace _p
 } //namespace _p
 
 
-template<typename T>
+template<typename T, typename NodeAllocator>
 class dl_list
 {
 public:
 	using value_type      = T;
+	using allocator_type  = NodeAllocator;
 	using size_type       = uintptr_t;
 	using reference       = value_type&;
 	using const_reference = value_type const&;
@@ -197,21 +278,91 @@ public:
 
 public:
 	inline dl_list() = default;
+
+	template<typename... AllocArgs>
+	inline explicit dl_list(std::in_place_t, AllocArgs&&... p_alloc_args): _alloc(std::forward<AllocArgs>(p_alloc_args)...) {}
+
+	dl_list(dl_list const& p_other): _alloc(p_other._alloc.fresh())
+	{
+		try
+		{
+			_append_copy(p_other.__end.next(), p_other._end_p());
+		}
+		catch(...)
+		{
+			clear();
+			throw;
+		}
+	}
+
+	dl_list(dl_list&& p_other) noexcept: _alloc(std::move(p_other._alloc))
+	{
+		_steal(p_other);
+	}
+
 	~dl_list()
 	{
-		_Container_t* pivot = __end.next;
+		if constexpr(_bulk_teardown)
+		{
+			_alloc.reset();
+		}
+		else
+		{
+			_release(__end.next());
+		}
+	}
+
+	///	\brief Copies \p p_other, reusing the nodes already held by this list.
+	dl_list& operator = (dl_list const& p_other)
+	{
+		if(this == &p_other)
+		{
+			return *this;
+		}
+
 		_Container_t* const end_p = _end_p();
-		while(pivot != end_p)
+		_Container_t* const other_end = p_other._end_p();
+		_Container_t* src = p_other.__end.next();
+
+		if constexpr(std::is_copy_assignable_v<value_type>)
 		{
-			_Container_t* const delete_me = pivot;
-			pivot = pivot->next;
-			delete delete_me;
+			_Container_t* dst = __end.next();
+			for(; dst != end_p && src != other_end; dst = dst->next(), src = src->next())
+			{
+				dst->obj = src->obj;
+			}
+			erase(const_iterator{dst}, end());
+		}
+		else
+		{
+			clear();
+		}
+
+		_append_copy(src, other_end);
+		return *this;
+	}
+
+	dl_list& operator = (dl_list&& p_other) noexcept
+	{
+		if(this != &p_other)
+		{
+			if constexpr(_bulk_teardown)
+			{
+				_alloc.reset();
+			}
+			else
+			{
+				_release(__end.next());
+			}
+			_alloc = std::move(p_other._alloc);
+			_steal(p_other);
 		}
+		return *this;
 	}
 
-	[[nodiscard]] inline iterator               begin  ()       noexcept { return iterator      {__end.next}; }
-	[[nodiscard]] inline const_iterator         begin  () const noexcept { return const_iterator{__end.next}; }
-	[[nodiscard]] inline const_iterator         cbegin () const noexcept { return const_iterator{__end.next}; }
+	[[nodiscard]] inline iterator               begin  ()       noexcept { return iterator      {__end.next()}; }
+	[[nodiscard]] inline const_iterator         begin  () const noexcept { return const_iterator{__end.next()}; }
+	[[nodiscard]] inline const_iterator         cbegin () const noexcept { return const_iterator{__end.next()}; }
 
 	[[nodiscard]] inline iterator               end    ()       noexcept { return iterator      {_end_p()}; }
 	[[nodiscard]] inline const_iterator         end    () const noexcept { return const_iterator{_end_p()}; }
@@ -225,35 +376,115 @@ public:
 	[[nodiscard]] inline const_reverse_iterator rend   () const noexcept { return const_reverse_iterator(cbegin()); }
 	[[nodiscard]] inline const_reverse_iterator crend  () const noexcept { return const_reverse_iterator(cbegin()); }
 
-	[[nodiscard]] inline bool                   empty  () const noexcept { return __end.next == _end_p(); }
+	[[nodiscard]] inline bool                   empty  () const noexcept { return __end.next() == _end_p(); }
+
+	[[nodiscard]] inline allocator_type&        get_allocator()       noexcept { return _alloc; }
+	[[nodiscard]] inline allocator_type const&  get_allocator() const noexcept { return _alloc; }
 
 	void clear() noexcept
 	{
 		_Container_t* const end_p = _end_p();
-		_Container_t* pivot = __end.next;
-		__end.prev = end_p;
-		__end.next = end_p;
+		_Container_t* const pivot = __end.next();
+		__end.set_prev(end_p);
+		__end.set_next(end_p);
+
+		if constexpr(_bulk_teardown)
+		{
+			_alloc.reset();
+		}
+		else
+		{
+			_release(pivot);
+		}
+	}
+
+	///	\brief Relocates every node into a fresh allocator, in list order.
+	///	\details Restores locality after heavy insert/erase churn.
+	///		Trivially relocatable elements are moved with a single memcpy per node,
+	///		without running move constructors or destructors.
+	///		If an allocation fails the list is left untouched.
+	void compact()
+	{
+		static_assert(dl_is_trivially_relocatable_v<value_type> || std::is_nothrow_move_constructible_v<value_type>,
+			"compact() requires trivially relocatable or nothrow move constructible elements");
+
+		allocator_type fresh = _alloc.fresh();
+		_Container_t* const end_p = _end_p();
+
+		//reserve every node up front, chained through their first word, nothing below this can throw
+		void* spare = nullptr;
+		void** spare_tail = &spare;
+		try
+		{
+			for(_Container_t* pivot = __end.next(); pivot != end_p; pivot = pivot->next())
+			{
+				void* const mem = fresh.template allocate<_Container_t>();
+				*static_cast<void**>(mem) = nullptr;
+				*spare_tail = mem;
+				spare_tail = static_cast<void**>(mem);
+			}
+		}
+		catch(...)
+		{
+			while(spare)
+			{
+				void* const release_me = spare;
+				spare = *static_cast<void**>(spare);
+				fresh.template deallocate<_Container_t>(release_me);
+			}
+			throw;
+		}
 
+		_Container_t* prev = end_p;
+		_Container_t* pivot = __end.next();
 		while(pivot != end_p)
 		{
-			_Container_t* const delete_me = pivot;
-			pivot = pivot->next;
-			delete delete_me;
+			_Container_t* const old_node = pivot;
+			pivot = pivot->next();
+
+			void* const mem = spare;
+			spare = *static_cast<void**>(spare);
+			_Container_t* node;
+			if constexpr(dl_is_trivially_relocatable_v<value_type>)
+			{
+				std::memcpy(mem, static_cast<void*>(old_node), sizeof(_Container_t));
+				node = static_cast<_Container_t*>(mem);
+				if constexpr(!_p::_has_bulk_reset<allocator_type>)
+				{
+					_alloc.template deallocate<_Container_t>(old_node);
+				}
+			}
+			else
+			{
+				node = new (mem) _Container_t(std::move(old_node->obj));
+				_delete_node(old_node);
+			}
+
+			node->set_prev(prev);
+			prev->set_next(node);
+			prev = node;
+		}
+		prev->set_next(end_p);
+		__end.set_prev(prev);
+
+		if constexpr(_p::_has_bulk_reset<allocator_type>)
+		{
+			_alloc.reset();
 		}
+		_alloc = std::move(fresh);
 	}
 
 	template< class... Args >
 	iterator emplace(const_iterator pos, Args&&... args)
 	{
 		_Container_t* const next = pos._container;
-		_Container_t* const prev = next->prev;
-		_Container_t* const container =
-			new _Container_t(std::forward<Args>(args)...);
+		_Container_t* const prev = next->prev();
+		_Container_t* const container = _new_node(std::forward<Args>(args)...);
 
-		next     ->prev = container;
-		prev     ->next = container;
-		container->next = next;
-		container->prev = prev;
+		next     ->set_prev(container);
+		prev     ->set_next(container);
+		container->set_next(next);
+		container->set_prev(prev);
 
 		return iterator{container};
 	}
@@ -271,31 +502,31 @@ public:
 	iterator erase(const_iterator const pos)
 	{
 		_Container_t* const container = pos._container;
-		_Container_t* const prev      = container->prev;
-		_Container_t* const next      = container->next;
-		prev->next = next;
-		next->prev = prev;
-		delete container;
+		_Container_t* const prev      = container->prev();
+		_Container_t* const next      = container->next();
+		prev->set_next(next);
+		next->set_prev(prev);
+		_delete_node(container);
 
 		return iterator{next};
 	}
 
 	iterator erase(const_iterator const first, const_iterator const last)
 	{
-		_Container_t* const prev      = first._container->prev;
-		_Container_t* const last      = last._container;
-		prev->next = last;
-		last->prev = prev;
+		_Container_t* const prev      = first._container->prev();
+		_Container_t* const last_p    = last._container;
+		prev  ->set_next(last_p);
+		last_p->set_prev(prev);
 
 		_Container_t* pivot = first._container;
-		while(pivot != last)
+		while(pivot != last_p)
 		{
 			_Container_t* const delete_me = pivot;
-			pivot = pivot->next;
-			delete delete_me;
+			pivot = pivot->next();
+			_delete_node(delete_me);
 		}
 
-		return iterator{last};
+		return iterator{last_p};
 	}
 
 	void push_back(const value_type& value)
@@ -310,11 +541,11 @@ public:
 
 	void pop_back()
 	{
-		_Container_t* const container = __end.prev;
-		_Container_t* const prev = container->prev;
-		prev->next = _end_p();
-		__end.prev = prev;
-		delete container;
+		_Container_t* const container = __end.prev();
+		_Container_t* const prev = container->prev();
+		prev->set_next(_end_p());
+		__end.set_prev(prev);
+		_delete_node(container);
 	}
 
 	void push_front(const value_type& value)
@@ -329,11 +560,11 @@ public:
 
 	void pop_front()
 	{
-		_Container_t* const container = __end.next;
-		_Container_t* const next = container->next;
-		next->prev = _end_p();
-		__end.next = next;
-		delete container;
+		_Container_t* const container = __end.next();
+		_Container_t* const next = container->next();
+		next->set_prev(_end_p());
+		__end.set_next(next);
+		_delete_node(container);
 	}
 
 #if 0
@@ -344,12 +575,8 @@ public:
 	explicit dl_list( size_type count);
 	template< class InputIt >
 	dl_list(InputIt first, InputIt last);
-	dl_list(const dl_list& other);
-	dl_list(dl_list&& other );
 	dl_list(std::initializer_list<value_type> init);
 
-	dl_list& operator=( const dl_list& other );
-	dl_list& operator=( dl_list&& other );
 	dl_list& operator=(std::initializer_list<value_type> ilist );
 
 	void assign(size_type count, const value_type& value );
@@ -422,7 +649,98 @@ private:
 		return const_cast<_Container_t* const>(static_cast<_Container_t const* const>(&__end));
 	}
 
+	///	\brief Nodes need neither destruction nor individual release, the allocator can drop them all at once.
+	static constexpr bool _bulk_teardown = std::is_trivially_destructible_v<value_type> && _p::_has_bulk_reset<allocator_type>;
+
+	template< class... Args >
+	[[nodiscard]] _Container_t* _new_node(Args&&... args)
+	{
+		void* const mem = _alloc.template allocate<_Container_t>();
+		try
+		{
+			return new (mem) _Container_t(std::forward<Args>(args)...);
+		}
+		catch(...)
+		{
+			_alloc.template deallocate<_Container_t>(mem);
+			throw;
+		}
+	}
+
+	[[nodiscard]] _Container_t* _clone_node(_Container_t const* const p_node)
+	{
+		if constexpr(std::is_trivially_copyable_v<value_type>)
+		{
+			void* const mem = _alloc.template allocate<_Container_t>();
+			std::memcpy(mem, static_cast<void const*>(p_node), sizeof(_Container_t));
+			return static_cast<_Container_t*>(mem);
+		}
+		else
+		{
+			return _new_node(p_node->obj);
+		}
+	}
+
+	inline void _delete_node(_Container_t* const p_node) noexcept
+	{
+		if constexpr(!std::is_trivially_destructible_v<value_type>)
+		{
+			p_node->~_Container_t();
+		}
+		_alloc.template deallocate<_Container_t>(p_node);
+	}
+
+	void _release(_Container_t* pivot) noexcept
+	{
+		_Container_t* const end_p = _end_p();
+		while(pivot != end_p)
+		{
+			_Container_t* const delete_me = pivot;
+			pivot = pivot->next();
+			_delete_node(delete_me);
+		}
+	}
+
+	///	\brief Appends copies of [p_first, p_last) from another list.
+	void _append_copy(_Container_t const* p_first, _Container_t const* const p_last)
+	{
+		_Container_t* const end_p = _end_p();
+		_Container_t* prev = __end.prev();
+		for(; p_first != p_last; p_first = p_first->next())
+		{
+			_Container_t* const node = _clone_node(p_first);
+			node->set_prev(prev);
+			node->set_next(end_p);
+			prev->set_next(node);
+			__end.set_prev(node);
+			prev = node;
+		}
+	}
+
+	///	\brief Takes over the nodes of \p p_other, whose allocator has already been moved into this list.
+	void _steal(dl_list& p_other) noexcept
+	{
+		_Container_t* const end_p = _end_p();
+		_Container_t* const other_end = p_other._end_p();
+		_Container_t* const first = p_other.__end.next();
+		if(first == other_end)
+		{
+			__end.set_next(end_p);
+			__end.set_prev(end_p);
+			return;
+		}
+
+		_Container_t* const last = p_other.__end.prev();
+		__end.set_next(first);
+		__end.set_prev(last);
+		first->set_prev(end_p);
+		last ->set_next(end_p);
+		p_other.__end.set_next(other_end);
+		p_other.__end.set_prev(other_end);
+	}
+
 	_p::_ContainerHeader<value_type> __end;
+	[[no_unique_address]] allocator_type _alloc;
 };
 
 #endif // !EASY_MODE
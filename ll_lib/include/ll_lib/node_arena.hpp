@@ -0,0 +1,112 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace _p
+{
+	///	\brief Header placed at the start of every arena, arenas are chained for release.
+	struct _ArenaHeader
+	{
+		_ArenaHeader* prev;
+		uintptr_t size;
+		bool mapped;
+		bool huge;
+	};
+
+	struct _FreeNode
+	{
+		_FreeNode* next;
+	};
+} //namespace _p
+
+///	\brief Node allocation policy for dl_list that carves nodes out of large arenas.
+///	\details Arenas are reserved directly from the OS, aligned to 2MiB, and flagged for (transparent) huge pages
+///		where the platform allows it, falling back to regular pages or the heap otherwise.
+///		Nodes are bump allocated, so their placement follows insertion order; freed nodes are recycled LIFO.
+///		Memory is only returned to the OS when the allocator is destroyed.
+///	\note An instance serves a single node type, which is always the case when owned by a dl_list.
+class dl_arena_node_allocator
+{
+public:
+	static constexpr uintptr_t huge_page_size     = uintptr_t{2} << 20;
+	static constexpr uintptr_t default_arena_size = uintptr_t{64} << 20;
+
+public:
+	explicit dl_arena_node_allocator(uintptr_t p_arena_size = default_arena_size) noexcept;
+	~dl_arena_node_allocator();
+
+	dl_arena_node_allocator(dl_arena_node_allocator const&)             = delete;
+	dl_arena_node_allocator& operator = (dl_arena_node_allocator const&) = delete;
+
+	dl_arena_node_allocator(dl_arena_node_allocator&& p_other) noexcept;
+	dl_arena_node_allocator& operator = (dl_arena_node_allocator&& p_other) noexcept;
+
+	///	\brief An empty allocator with the same arena size.
+	[[nodiscard]] inline dl_arena_node_allocator fresh() const noexcept { return dl_arena_node_allocator{_arena_size}; }
+
+	///	\brief Drops every node at once, keeping the most recent arena for reuse.
+	void reset() noexcept;
+
+	template<typename Node>
+	[[nodiscard]] inline void* allocate()
+	{
+		static_assert(alignof(Node) <= alignof(std::max_align_t), "over-aligned nodes are not supported");
+
+		if(_free)
+		{
+			_p::_FreeNode* const node = _free;
+			_free = node->next;
+			return node;
+		}
+
+		constexpr uintptr_t stride = _stride(sizeof(Node), alignof(Node));
+		if(static_cast<uintptr_t>(_limit - _cursor) < stride)
+		{
+			_grow(stride);
+		}
+		void* const node = _cursor;
+		_cursor += stride;
+		return node;
+	}
+
+	template<typename Node>
+	inline void deallocate(void* const p_node) noexcept
+	{
+		_p::_FreeNode* const node = static_cast<_p::_FreeNode*>(p_node);
+		node->next = _free;
+		_free = node;
+	}
+
+	[[nodiscard]] inline uintptr_t arena_size() const noexcept { return _arena_size; }
+
+	///	\brief Number of arenas reserved so far.
+	[[nodiscard]] uintptr_t arena_count() const noexcept;
+
+	///	\brief True if every arena reserved so far was granted huge page backing (or advice, for THP).
+	[[nodiscard]] bool huge_pages() const noexcept;
+
+private:
+	[[nodiscard]] static constexpr uintptr_t _stride(uintptr_t const p_size, uintptr_t const p_align)
+	{
+		uintptr_t const size = p_size < sizeof(_p::_FreeNode) ? sizeof(_p::_FreeNode) : p_size;
+		uintptr_t const align = p_align < alignof(_p::_FreeNode) ? alignof(_p::_FreeNode) : p_align;
+		return (size + align - 1) & ~(align - 1);
+	}
+
+	void _grow(uintptr_t p_min_size);
+	void _release() noexcept;
+
+	uintptr_t        _arena_size;
+	_p::_ArenaHeader* _arenas = nullptr;
+	_p::_FreeNode*    _free   = nullptr;
+	std::byte*        _cursor = nullptr;
+	std::byte*        _limit  = nullptr;
+};
@@ -0,0 +1,261 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace _p
+{
+	///	\brief Slot of the ring, the chain is closed once at construction and never relinked.
+	template<typename T>
+	struct _RingContainer
+	{
+		_RingContainer* next;
+		alignas(T) std::byte storage[sizeof(T)];
+
+		[[nodiscard]] inline T* obj() noexcept { return std::launder(reinterpret_cast<T*>(storage)); }
+	};
+} //namespace _p
+
+///	\brief Bounded, wait-free, single producer / single consumer queue.
+///	\details Elements live in a preallocated circular chain of slots, so push and pop never allocate.
+///		Each side owns one cache line holding its published position and a cached copy of the other side's position,
+///		the shared positions are only re-read when the cached copy says the queue looks full (or empty).
+///		push_batch and pop_batch publish once per batch.
+///	\note try_push/push_batch may only be called from one thread at a time, and try_pop/pop_batch from one other thread.
+template<typename T>
+class dl_spsc_queue
+{
+public:
+	using value_type = T;
+	using size_type  = uintptr_t;
+
+	static constexpr size_type cache_line_size = 64;
+
+private:
+	using _Container_t = _p::_RingContainer<value_type>;
+
+public:
+	explicit dl_spsc_queue(size_type const p_capacity)
+		: _capacity(p_capacity ? p_capacity : 1)
+		, _ring(static_cast<_Container_t*>(::operator new(_capacity * sizeof(_Container_t), std::align_val_t{alignof(_Container_t)})))
+	{
+		for(size_type i = 0; i + 1 < _capacity; ++i)
+		{
+			_ring[i].next = &_ring[i + 1];
+		}
+		_ring[_capacity - 1].next = _ring;
+
+		_producer.tail = _ring;
+		_consumer.head = _ring;
+	}
+
+	dl_spsc_queue(dl_spsc_queue const&)             = delete;
+	dl_spsc_queue& operator = (dl_spsc_queue const&) = delete;
+
+	~dl_spsc_queue()
+	{
+		if constexpr(!std::is_trivially_destructible_v<value_type>)
+		{
+			size_type count = _producer.write.load(std::memory_order_relaxed) - _consumer.read.load(std::memory_order_relaxed);
+			for(_Container_t* pivot = _consumer.head; count--; pivot = pivot->next)
+			{
+				pivot->obj()->~value_type();
+			}
+		}
+		::operator delete(_ring, std::align_val_t{alignof(_Container_t)});
+	}
+
+	[[nodiscard]] inline size_type capacity() const noexcept { return _capacity; }
+
+	///	\brief Number of elements, exact only when called while neither side is active.
+	[[nodiscard]] inline size_type size_approx() const noexcept
+	{
+		return _producer.write.load(std::memory_order_acquire) - _consumer.read.load(std::memory_order_acquire);
+	}
+
+	[[nodiscard]] inline bool empty_approx() const noexcept { return size_approx() == 0; }
+
+	//======== Producer ========
+
+	template< class... Args >
+	[[nodiscard]] bool try_emplace(Args&&... args)
+	{
+		uint64_t const write = _producer.write.load(std::memory_order_relaxed);
+		if(!_writable(write, 1))
+		{
+			return false;
+		}
+
+		_Container_t* const tail = _producer.tail;
+		new (tail->storage) value_type(std::forward<Args>(args)...);
+		_producer.tail = tail->next;
+		_producer.write.store(write + 1, std::memory_order_release);
+		return true;
+	}
+
+	[[nodiscard]] inline bool try_push(const value_type& value) { return try_emplace(value); }
+	[[nodiscard]] inline bool try_push(value_type&& value)      { return try_emplace(std::move(value)); }
+
+	///	\brief Pushes up to \p p_count elements read from \p p_first.
+	///	\return Number of elements pushed.
+	template<typename InputIt>
+	size_type push_batch(InputIt p_first, size_type const p_count)
+	{
+		uint64_t const write = _producer.write.load(std::memory_order_relaxed);
+		size_type const count = _writable_count(write, p_count);
+
+		_Container_t* tail = _producer.tail;
+		size_type done = 0;
+		try
+		{
+			for(; done < count; ++done, ++p_first)
+			{
+				new (tail->storage) value_type(*p_first);
+				tail = tail->next;
+			}
+		}
+		catch(...)
+		{
+			_publish_write(tail, write + done);
+			throw;
+		}
+
+		_publish_write(tail, write + count);
+		return count;
+	}
+
+	//======== Consumer ========
+
+	[[nodiscard]] bool try_pop(value_type& p_out)
+	{
+		uint64_t const read = _consumer.read.load(std::memory_order_relaxed);
+		if(!_readable(read, 1))
+		{
+			return false;
+		}
+
+		_Container_t* const head = _consumer.head;
+		value_type* const obj = head->obj();
+		p_out = std::move(*obj);
+		obj->~value_type();
+		_consumer.head = head->next;
+		_consumer.read.store(read + 1, std::memory_order_release);
+		return true;
+	}
+
+	///	\brief Pops up to \p p_max elements into \p p_out.
+	///	\return Number of elements popped.
+	template<typename OutputIt>
+	size_type pop_batch(OutputIt p_out, size_type const p_max)
+	{
+		uint64_t const read = _consumer.read.load(std::memory_order_relaxed);
+		size_type const count = _readable_count(read, p_max);
+
+		_Container_t* head = _consumer.head;
+		size_type done = 0;
+		try
+		{
+			for(; done < count; ++done, ++p_out)
+			{
+				value_type* const obj = head->obj();
+				*p_out = std::move(*obj);
+				obj->~value_type();
+				head = head->next;
+			}
+		}
+		catch(...)
+		{
+			_publish_read(head, read + done);
+			throw;
+		}
+
+		_publish_read(head, read + count);
+		return count;
+	}
+
+private:
+	[[nodiscard]] inline bool _writable(uint64_t const p_write, size_type const p_count) noexcept
+	{
+		if(p_write - _producer.cached_read + p_count <= _capacity)
+		{
+			return true;
+		}
+		_producer.cached_read = _consumer.read.load(std::memory_order_acquire);
+		return p_write - _producer.cached_read + p_count <= _capacity;
+	}
+
+	[[nodiscard]] inline size_type _writable_count(uint64_t const p_write, size_type const p_count) noexcept
+	{
+		size_type free_slots = _capacity - static_cast<size_type>(p_write - _producer.cached_read);
+		if(free_slots < p_count)
+		{
+			_producer.cached_read = _consumer.read.load(std::memory_order_acquire);
+			free_slots = _capacity - static_cast<size_type>(p_write - _producer.cached_read);
+		}
+		return free_slots < p_count ? free_slots : p_count;
+	}
+
+	[[nodiscard]] inline bool _readable(uint64_t const p_read, size_type const p_count) noexcept
+	{
+		if(_consumer.cached_write - p_read >= p_count)
+		{
+			return true;
+		}
+		_consumer.cached_write = _producer.write.load(std::memory_order_acquire);
+		return _consumer.cached_write - p_read >= p_count;
+	}
+
+	[[nodiscard]] inline size_type _readable_count(uint64_t const p_read, size_type const p_max) noexcept
+	{
+		size_type available = static_cast<size_type>(_consumer.cached_write - p_read);
+		if(available < p_max)
+		{
+			_consumer.cached_write = _producer.write.load(std::memory_order_acquire);
+			available = static_cast<size_type>(_consumer.cached_write - p_read);
+		}
+		return available < p_max ? available : p_max;
+	}
+
+	inline void _publish_write(_Container_t* const p_tail, uint64_t const p_write) noexcept
+	{
+		_producer.tail = p_tail;
+		_producer.write.store(p_write, std::memory_order_release);
+	}
+
+	inline void _publish_read(_Container_t* const p_head, uint64_t const p_read) noexcept
+	{
+		_consumer.head = p_head;
+		_consumer.read.store(p_read, std::memory_order_release);
+	}
+
+	struct alignas(cache_line_size) _ProducerSide
+	{
+		std::atomic<uint64_t> write{0};
+		uint64_t cached_read = 0;
+		_Container_t* tail = nullptr;
+	};
+
+	struct alignas(cache_line_size) _ConsumerSide
+	{
+		std::atomic<uint64_t> read{0};
+		uint64_t cached_write = 0;
+		_Container_t* head = nullptr;
+	};
+
+	_ProducerSide _producer;
+	_ConsumerSide _consumer;
+
+	alignas(cache_line_size) size_type const _capacity;
+	_Container_t* const _ring;
+};
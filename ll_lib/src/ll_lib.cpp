@@ -2,8 +2,247 @@
 ///	\file
 ///
 ///	\copyright
-///		
+///
 //======== ======== ======== ======== ======== ======== ======== ========
 
 #include "ll_lib/ll_lib.hpp"
+#include "ll_lib/node_arena.hpp"
+
+#include <new>
+
+#if defined(_WIN32)
+#	define WIN32_LEAN_AND_MEAN
+#	define NOMINMAX
+#	include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#	include <sys/mman.h>
+#endif
+
+namespace
+{
+	[[nodiscard]] constexpr uintptr_t round_up(uintptr_t const p_size, uintptr_t const p_align)
+	{
+		return (p_size + p_align - 1) / p_align * p_align;
+	}
+
+	//======== ======== ======== Arena reservation ======== ======== ========
+
+	struct arena_block
+	{
+		void* ptr;
+		uintptr_t size;
+		bool mapped;
+		bool huge;
+	};
+
+	///	\brief Tries to reserve \p p_size bytes straight from the OS, preferring huge pages.
+	///	\return ptr is null on failure.
+	arena_block reserve_mapped(uintptr_t const p_size)
+	{
+		constexpr uintptr_t huge_page = dl_arena_node_allocator::huge_page_size;
+		arena_block block{nullptr, p_size, true, false};
+
+#if defined(_WIN32)
+		//needs SeLockMemoryPrivilege, usually not granted
+		SIZE_T const large_page = GetLargePageMinimum();
+		if(large_page)
+		{
+			SIZE_T const size = round_up(p_size, large_page);
+			block.ptr = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE);
+			if(block.ptr)
+			{
+				block.size = size;
+				block.huge = true;
+				return block;
+			}
+		}
+		block.ptr = VirtualAlloc(nullptr, p_size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+
+#elif defined(__unix__) || defined(__APPLE__)
+		//over-reserve so that the region can be trimmed to a huge page boundary
+		uintptr_t const span = p_size + huge_page;
+		void* const raw = mmap(nullptr, span, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS
+#	ifdef MAP_NORESERVE
+			| MAP_NORESERVE
+#	endif
+			, -1, 0);
+
+		if(raw == MAP_FAILED)
+		{
+			return block;
+		}
+
+		uintptr_t const raw_begin = reinterpret_cast<uintptr_t>(raw);
+		uintptr_t const begin     = round_up(raw_begin, huge_page);
+		uintptr_t const head      = begin - raw_begin;
+		uintptr_t const tail      = span - head - p_size;
+		if(head) munmap(raw, head);
+		if(tail) munmap(reinterpret_cast<void*>(begin + p_size), tail);
+
+		block.ptr = reinterpret_cast<void*>(begin);
+#	ifdef MADV_HUGEPAGE
+		block.huge = madvise(block.ptr, p_size, MADV_HUGEPAGE) == 0;
+#	endif
+
+#else
+		static_cast<void>(huge_page);
+#endif
+		return block;
+	}
+
+	void release_mapped(void* const p_ptr, [[maybe_unused]] uintptr_t const p_size)
+	{
+#if defined(_WIN32)
+		VirtualFree(p_ptr, 0, MEM_RELEASE);
+#elif defined(__unix__) || defined(__APPLE__)
+		munmap(p_ptr, p_size);
+#else
+		static_cast<void>(p_ptr);
+#endif
+	}
+
+	arena_block reserve_arena(uintptr_t const p_size)
+	{
+		arena_block block = reserve_mapped(p_size);
+		if(!block.ptr)
+		{
+			block = arena_block{
+				::operator new(p_size, std::align_val_t{dl_arena_node_allocator::huge_page_size}),
+				p_size, false, false};
+		}
+		return block;
+	}
+
+	void release_arena(_p::_ArenaHeader* const p_arena)
+	{
+		if(p_arena->mapped)
+		{
+			release_mapped(p_arena, p_arena->size);
+		}
+		else
+		{
+			::operator delete(p_arena, std::align_val_t{dl_arena_node_allocator::huge_page_size});
+		}
+	}
+
+	constexpr uintptr_t arena_header_size = round_up(sizeof(_p::_ArenaHeader), 64);
+
+} //namespace
+
+
+//======== ======== ======== dl_arena_node_allocator ======== ======== ========
+
+dl_arena_node_allocator::dl_arena_node_allocator(uintptr_t const p_arena_size) noexcept
+	: _arena_size(round_up(p_arena_size ? p_arena_size : huge_page_size, huge_page_size))
+{
+}
+
+dl_arena_node_allocator::dl_arena_node_allocator(dl_arena_node_allocator&& p_other) noexcept
+	: _arena_size(p_other._arena_size)
+	, _arenas    (p_other._arenas)
+	, _free      (p_other._free)
+	, _cursor    (p_other._cursor)
+	, _limit     (p_other._limit)
+{
+	p_other._arenas = nullptr;
+	p_other._free   = nullptr;
+	p_other._cursor = nullptr;
+	p_other._limit  = nullptr;
+}
+
+dl_arena_node_allocator& dl_arena_node_allocator::operator = (dl_arena_node_allocator&& p_other) noexcept
+{
+	if(this != &p_other)
+	{
+		_release();
+		_arena_size = p_other._arena_size;
+		_arenas     = p_other._arenas;
+		_free       = p_other._free;
+		_cursor     = p_other._cursor;
+		_limit      = p_other._limit;
+		p_other._arenas = nullptr;
+		p_other._free   = nullptr;
+		p_other._cursor = nullptr;
+		p_other._limit  = nullptr;
+	}
+	return *this;
+}
+
+dl_arena_node_allocator::~dl_arena_node_allocator()
+{
+	_release();
+}
+
+void dl_arena_node_allocator::reset() noexcept
+{
+	_free = nullptr;
+	if(!_arenas)
+	{
+		return;
+	}
+
+	_p::_ArenaHeader* pivot = _arenas->prev;
+	while(pivot)
+	{
+		_p::_ArenaHeader* const release_me = pivot;
+		pivot = pivot->prev;
+		release_arena(release_me);
+	}
+	_arenas->prev = nullptr;
+
+	std::byte* const begin = reinterpret_cast<std::byte*>(_arenas);
+	_cursor = begin + arena_header_size;
+	_limit  = begin + _arenas->size;
+}
+
+void dl_arena_node_allocator::_release() noexcept
+{
+	_p::_ArenaHeader* pivot = _arenas;
+	while(pivot)
+	{
+		_p::_ArenaHeader* const release_me = pivot;
+		pivot = pivot->prev;
+		release_arena(release_me);
+	}
+	_arenas = nullptr;
+	_free   = nullptr;
+	_cursor = nullptr;
+	_limit  = nullptr;
+}
+
+uintptr_t dl_arena_node_allocator::arena_count() const noexcept
+{
+	uintptr_t count = 0;
+	for(_p::_ArenaHeader const* pivot = _arenas; pivot; pivot = pivot->prev)
+	{
+		++count;
+	}
+	return count;
+}
+
+bool dl_arena_node_allocator::huge_pages() const noexcept
+{
+	for(_p::_ArenaHeader const* pivot = _arenas; pivot; pivot = pivot->prev)
+	{
+		if(!pivot->huge) return false;
+	}
+	return _arenas != nullptr;
+}
+
+void dl_arena_node_allocator::_grow(uintptr_t const p_min_size)
+{
+	uintptr_t size = _arena_size;
+	if(size < arena_header_size + p_min_size)
+	{
+		size = round_up(arena_header_size + p_min_size, huge_page_size);
+	}
+
+	arena_block const block = reserve_arena(size);
+
+	_p::_ArenaHeader* const arena = new (block.ptr) _p::_ArenaHeader{_arenas, block.size, block.mapped, block.huge};
+	_arenas = arena;
 
+	std::byte* const begin = static_cast<std::byte*>(block.ptr);
+	_cursor = begin + arena_header_size;
+	_limit  = begin + block.size;
+}
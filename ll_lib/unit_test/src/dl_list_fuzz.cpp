@@ -0,0 +1,399 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\brief Differential operation-sequence fuzzer for dl_list against std::list.
+///	\details Besides the contents, every operation is checked against an allocation and node-hop budget,
+///		so that complexity regressions (an O(n) erase, an extra allocation in emplace) fail like wrong results do.
+///		Node hops (every read of a node link) are only counted when LL_LIB_TRACE_HOPS is defined for the whole binary.
+///
+///		Runs as part of ll_test with a fixed set of seeds, set LL_FUZZ_SEED to replay a single seed.
+///		Can also be built as a libFuzzer target:
+///			clang++ -std=c++20 -fsanitize=fuzzer,address -DLL_LIB_LIBFUZZER -DLL_LIB_TRACE_HOPS -I../include dl_list_fuzz.cpp
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
+#include <list>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <ll_lib/ll_lib.hpp>
+
+#ifndef LL_LIB_LIBFUZZER
+#	include <gtest/gtest.h>
+#endif
+
+namespace
+{
+	struct fuzz_cost
+	{
+		uintptr_t allocs;
+		uintptr_t deallocs;
+		uintptr_t hops;
+	};
+
+	thread_local fuzz_cost g_counters{0, 0, 0};
+
+	///	\brief Heap policy that counts node allocations.
+	struct counting_node_allocator
+	{
+		[[nodiscard]] inline counting_node_allocator fresh() const noexcept { return {}; }
+
+		template<typename Node>
+		[[nodiscard]] inline void* allocate()
+		{
+			++g_counters.allocs;
+			return m_heap.allocate<Node>();
+		}
+
+		template<typename Node>
+		inline void deallocate(void* const p_node) noexcept
+		{
+			++g_counters.deallocs;
+			m_heap.deallocate<Node>(p_node);
+		}
+
+		[[no_unique_address]] dl_heap_node_allocator m_heap;
+	};
+
+	using fuzz_list = dl_list<uint32_t, counting_node_allocator>;
+	using ref_list  = std::list<uint32_t>;
+
+	[[nodiscard]] inline fuzz_cost snapshot()
+	{
+		fuzz_cost cost = g_counters;
+#ifdef LL_LIB_TRACE_HOPS
+		cost.hops = _p::_node_hops;
+#endif
+		return cost;
+	}
+
+	class byte_reader
+	{
+	public:
+		byte_reader(uint8_t const* const p_data, size_t const p_size): m_data(p_data), m_end(p_data + p_size) {}
+
+		[[nodiscard]] bool done() const { return m_data == m_end; }
+
+		uint8_t u8()
+		{
+			return m_data == m_end ? 0 : *m_data++;
+		}
+
+		uint32_t u32()
+		{
+			uint32_t val = 0;
+			for(uint8_t i = 0; i < 4; ++i)
+			{
+				val = (val << 8) | u8();
+			}
+			return val;
+		}
+
+	private:
+		uint8_t const* m_data;
+		uint8_t const* const m_end;
+	};
+
+	///	\brief Replays one operation sequence.
+	///	\tparam List - fuzz_list, or a type derived from it that injects a regression.
+	template<typename List>
+	class fuzz_session
+	{
+	public:
+		static constexpr uintptr_t max_size = 512;
+
+		///	\return Description of the first failure, if any.
+		std::optional<std::string> run(uint8_t const* const p_data, size_t const p_size)
+		{
+			byte_reader reader{p_data, p_size};
+			for(uintptr_t op_index = 0; !reader.done(); ++op_index)
+			{
+				m_op_index = op_index;
+				step(reader);
+				if(!m_failure && !equivalent(m_list, m_reference))
+				{
+					fail("contents differ from std::list");
+				}
+				if(m_failure)
+				{
+					return m_failure;
+				}
+			}
+			return std::nullopt;
+		}
+
+	private:
+		void step(byte_reader& p_reader)
+		{
+			uintptr_t const size = m_reference.size();
+			switch(p_reader.u8() % 13)
+			{
+			case 0:
+				if(size < max_size)
+				{
+					uint32_t const val = p_reader.u32();
+					measure("push_back", {1, 0, 1}, [&]{ m_list.push_back(val); });
+					m_reference.push_back(val);
+				}
+				break;
+			case 1:
+				if(size < max_size)
+				{
+					uint32_t const val = p_reader.u32();
+					measure("push_front", {1, 0, 2}, [&]{ m_list.push_front(val); });
+					m_reference.push_front(val);
+				}
+				break;
+			case 2:
+				if(size)
+				{
+					measure("pop_back", {0, 1, 2}, [&]{ m_list.pop_back(); });
+					m_reference.pop_back();
+				}
+				break;
+			case 3:
+				if(size)
+				{
+					measure("pop_front", {0, 1, 2}, [&]{ m_list.pop_front(); });
+					m_reference.pop_front();
+				}
+				break;
+			case 4:
+			case 5:
+				if(size < max_size)
+				{
+					uintptr_t const pos = p_reader.u8() % (size + 1);
+					uint32_t const val = p_reader.u32();
+					typename List::const_iterator const it = std::next(m_list.cbegin(), pos);
+					if(pos & 1)
+					{
+						measure("insert", {1, 0, 1}, [&]{ m_list.insert(it, val); });
+					}
+					else
+					{
+						measure("emplace", {1, 0, 1}, [&]{ m_list.emplace(it, val); });
+					}
+					m_reference.insert(std::next(m_reference.cbegin(), pos), val);
+				}
+				break;
+			case 6:
+				if(size)
+				{
+					uintptr_t const pos = p_reader.u8() % size;
+					typename List::const_iterator const it = std::next(m_list.cbegin(), pos);
+					measure("erase", {0, 1, 2}, [&]{ m_list.erase(it); });
+					m_reference.erase(std::next(m_reference.cbegin(), pos));
+				}
+				break;
+			case 7:
+				{
+					uintptr_t const first = p_reader.u8() % (size + 1);
+					uintptr_t const count = p_reader.u8() % (size - first + 1);
+					typename List::const_iterator const it_first = std::next(m_list.cbegin(), first);
+					typename List::const_iterator const it_last  = std::next(it_first, count);
+					measure("erase range", {0, count, count + 1}, [&]{ m_list.erase(it_first, it_last); });
+					ref_list::const_iterator const ref_first = std::next(m_reference.cbegin(), first);
+					m_reference.erase(ref_first, std::next(ref_first, count));
+				}
+				break;
+			case 8:
+				measure("clear", {0, size, size + 1}, [&]{ m_list.clear(); });
+				m_reference.clear();
+				break;
+			case 9:
+				m_spare.reset();
+				measure("copy construct", {size, 0, size + 2}, [&]{ m_spare.emplace(m_list); });
+				m_spare_reference = m_reference;
+				if(!equivalent(*m_spare, m_spare_reference)) fail("copy differs from std::list");
+				break;
+			case 10:
+				if(m_spare)
+				{
+					uintptr_t const spare_size = m_spare_reference.size();
+					uintptr_t const allocs   = spare_size > size ? spare_size - size : 0;
+					uintptr_t const deallocs = size > spare_size ? size - spare_size : 0;
+					//walks both lists once, the surplus is released by a range erase
+					measure("copy assign", {allocs, deallocs, spare_size + size + 4}, [&]{ m_list = *m_spare; });
+					m_reference = m_spare_reference;
+				}
+				break;
+			case 11:
+				{
+					std::optional<List> moved;
+					measure("move construct", {0, 0, 2}, [&]{ moved.emplace(std::move(m_list)); });
+					if(!m_list.empty()) fail("moved from list is not empty");
+					measure("move assign", {0, 0, 3}, [&]{ m_list = std::move(*moved); });
+				}
+				break;
+			default:
+				//reserves every node before relocating, so the list is walked twice
+				measure("compact", {size, size, 2 * size + 2}, [&]{ m_list.compact(); });
+				break;
+			}
+		}
+
+		///	\brief Runs \p p_op and checks its cost against \p p_budget.
+		///	\details Allocations must match exactly, hops may stay under budget.
+		template<typename Op>
+		void measure(char const* const p_name, fuzz_cost const p_budget, Op&& p_op)
+		{
+			if(m_failure) return;
+
+			fuzz_cost const before = snapshot();
+			p_op();
+			fuzz_cost const after = snapshot();
+
+			uintptr_t const allocs   = after.allocs   - before.allocs;
+			uintptr_t const deallocs = after.deallocs - before.deallocs;
+			uintptr_t const hops     = after.hops     - before.hops;
+
+			if(allocs != p_budget.allocs || deallocs != p_budget.deallocs || hops > p_budget.hops)
+			{
+				fail(std::string{p_name}
+					+ " cost allocs/deallocs/hops " + std::to_string(allocs) + "/" + std::to_string(deallocs) + "/" + std::to_string(hops)
+					+ ", budget " + std::to_string(p_budget.allocs) + "/" + std::to_string(p_budget.deallocs) + "/<=" + std::to_string(p_budget.hops));
+			}
+		}
+
+		[[nodiscard]] static bool equivalent(List const& p_list, ref_list const& p_reference)
+		{
+			typename List::const_iterator it = p_list.cbegin();
+			for(uint32_t const ref : p_reference)
+			{
+				if(it == p_list.cend() || *it != ref) return false;
+				++it;
+			}
+			if(!(it == p_list.cend())) return false;
+
+			//and backwards, to validate the prev links
+			for(ref_list::const_reverse_iterator ref = p_reference.crbegin(); ref != p_reference.crend(); ++ref)
+			{
+				--it;
+				if(*it != *ref) return false;
+			}
+			return it == p_list.cbegin();
+		}
+
+		void fail(std::string const& p_message)
+		{
+			if(!m_failure)
+			{
+				m_failure = "operation " + std::to_string(m_op_index) + ": " + p_message;
+			}
+		}
+
+		List      m_list;
+		ref_list  m_reference;
+		std::optional<List> m_spare;
+		ref_list  m_spare_reference;
+		uintptr_t m_op_index = 0;
+		std::optional<std::string> m_failure;
+	};
+
+	[[nodiscard]] std::optional<std::string> run_sequence(uint8_t const* const p_data, size_t const p_size)
+	{
+		fuzz_session<fuzz_list> session;
+		return session.run(p_data, p_size);
+	}
+} //namespace
+
+#ifdef LL_LIB_LIBFUZZER
+
+extern "C" int LLVMFuzzerTestOneInput(uint8_t const* const p_data, size_t const p_size)
+{
+	std::optional<std::string> const failure = run_sequence(p_data, p_size);
+	if(failure)
+	{
+		std::fprintf(stderr, "dl_list fuzz failure, %s\n", failure->c_str());
+		std::abort();
+	}
+	return 0;
+}
+
+#else //LL_LIB_LIBFUZZER
+
+namespace
+{
+	[[nodiscard]] std::vector<uint8_t> make_sequence(uint64_t const p_seed, size_t const p_size)
+	{
+		std::mt19937_64 gen(p_seed);
+		std::vector<uint8_t> data(p_size);
+		for(uint8_t& byte : data)
+		{
+			byte = static_cast<uint8_t>(gen());
+		}
+		return data;
+	}
+} //namespace
+
+TEST(dl_list_fuzz, seeded_sequences)
+{
+	constexpr size_t sequence_size = 4096;
+
+	std::vector<uint64_t> seeds;
+	if(char const* const env_seed = std::getenv("LL_FUZZ_SEED"))
+	{
+		seeds.push_back(std::strtoull(env_seed, nullptr, 0));
+	}
+	else
+	{
+		for(uint64_t seed = 1; seed <= 64; ++seed)
+		{
+			seeds.push_back(seed);
+		}
+	}
+
+	for(uint64_t const seed : seeds)
+	{
+		std::vector<uint8_t> const data = make_sequence(seed, sequence_size);
+		std::optional<std::string> const failure = run_sequence(data.data(), data.size());
+		ASSERT_FALSE(failure.has_value()) << "LL_FUZZ_SEED=" << seed << ", " << *failure;
+	}
+}
+
+#ifdef LL_LIB_TRACE_HOPS
+namespace
+{
+	///	\brief Injected regression, walks from the front to the element being erased.
+	class walking_erase_list: public fuzz_list
+	{
+	public:
+		using fuzz_list::erase;
+
+		iterator erase(const_iterator const pos)
+		{
+			for(const_iterator it = cbegin(); it != pos; ++it) {}
+			return fuzz_list::erase(pos);
+		}
+	};
+} //namespace
+
+TEST(dl_list_fuzz, catches_linear_erase)
+{
+	std::vector<uint8_t> const data = make_sequence(1, 4096);
+	fuzz_session<walking_erase_list> session;
+	std::optional<std::string> const failure = session.run(data.data(), data.size());
+	ASSERT_TRUE(failure.has_value());
+	ASSERT_NE(failure->find(": erase cost"), std::string::npos) << *failure;
+}
+
+TEST(dl_list_fuzz, hop_tracing_enabled)
+{
+	fuzz_list list;
+	list.push_back(1);
+	list.push_back(2);
+	uintptr_t const before = _p::_node_hops;
+	list.clear();
+	ASSERT_EQ(_p::_node_hops - before, 3u);
+}
+#endif
+
+#endif //LL_LIB_LIBFUZZER
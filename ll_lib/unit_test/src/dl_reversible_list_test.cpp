@@ -0,0 +1,195 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <random>
+#include <limits>
+#include <list>
+
+#include <ll_lib/dl_reversible_list.hpp>
+
+#include "list_equivalence.hpp"
+
+
+template<typename T>
+void reversible_list_equivalence_test(dl_reversible_list<T> const& p_list, std::list<T> const& p_reference)
+{
+	standard_list_equivalence_test(p_list, p_reference);
+
+	p_list.visit(
+		[&p_reference](auto first, auto const last)
+		{
+			for(T const& ref : p_reference)
+			{
+				ASSERT_FALSE(first == last);
+				ASSERT_EQ(ref, *first);
+				++first;
+			}
+			ASSERT_TRUE(first == last);
+		});
+}
+
+TEST(dl_reversible_list, reverse)
+{
+	dl_reversible_list<uint32_t> list;
+	std::list<uint32_t> reference;
+
+	list.reverse();
+	ASSERT_TRUE(list.empty());
+	ASSERT_TRUE(list.reversed());
+	list.reverse();
+	ASSERT_FALSE(list.reversed());
+
+	for(uint32_t tcount = 0; tcount < 16; ++tcount)
+	{
+		list.push_back(tcount);
+		reference.push_back(tcount);
+	}
+
+	list.reverse();
+	reference.reverse();
+	reversible_list_equivalence_test(list, reference);
+
+	list.reverse();
+	reference.reverse();
+	reversible_list_equivalence_test(list, reference);
+}
+
+TEST(dl_reversible_list, random_operations)
+{
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<uint32_t> distrib(0, std::numeric_limits<uint32_t>::max());
+
+	dl_reversible_list<uint32_t> list;
+	std::list<uint32_t> reference;
+
+	for(uintptr_t tcount = 4096; --tcount;)
+	{
+		const uint32_t tcase = distrib(gen);
+		switch(tcase % 6)
+		{
+		case 0:
+			list.push_back(tcase);
+			reference.push_back(tcase);
+			break;
+		case 1:
+			list.push_front(tcase);
+			reference.push_front(tcase);
+			break;
+		case 2:
+			if(!reference.empty())
+			{
+				list.pop_back();
+				reference.pop_back();
+			}
+			break;
+		case 3:
+			if(!reference.empty())
+			{
+				list.pop_front();
+				reference.pop_front();
+			}
+			break;
+		case 4:
+			list.reverse();
+			reference.reverse();
+			break;
+		default:
+			{
+				auto it = list.begin();
+				auto std_it = reference.begin();
+				for(uint32_t step = tcase % 8; step-- && std_it != reference.end();)
+				{
+					++it;
+					++std_it;
+				}
+				ASSERT_EQ(*list.insert(it, tcase), tcase);
+				reference.insert(std_it, tcase);
+			}
+			break;
+		}
+		ASSERT_EQ(list.empty(), reference.empty());
+	}
+
+	reversible_list_equivalence_test(list, reference);
+}
+
+TEST(dl_reversible_list, erase)
+{
+	dl_reversible_list<uint32_t> list;
+	std::list<uint32_t> reference;
+
+	for(uint32_t tcount = 0; tcount < 1024; ++tcount)
+	{
+		list.push_back(tcount);
+		reference.push_back(tcount);
+	}
+	list.reverse();
+	reference.reverse();
+
+	auto it = list.begin();
+	auto std_it = reference.begin();
+	for(uintptr_t tcount = 100; --tcount;)
+	{
+		++it;
+		++std_it;
+	}
+
+	it     = list.erase(it);
+	std_it = reference.erase(std_it);
+	ASSERT_EQ(*it, *std_it);
+
+	auto it_last = it;
+	auto std_it_last = std_it;
+	for(uintptr_t tcount = 321; --tcount;)
+	{
+		++it_last;
+		++std_it_last;
+	}
+
+	it     = list.erase(it, it_last);
+	std_it = reference.erase(std_it, std_it_last);
+	ASSERT_EQ(*it, *std_it);
+	reversible_list_equivalence_test(list, reference);
+
+	list.reverse();
+	reference.reverse();
+	reversible_list_equivalence_test(list, reference);
+
+	list.clear();
+	ASSERT_TRUE(list.empty());
+}
+
+TEST(dl_reversible_list, visit_fixed_direction)
+{
+	dl_reversible_list<uint32_t> list;
+	for(uint32_t tcount = 0; tcount < 8; ++tcount)
+	{
+		list.push_back(tcount);
+	}
+	list.reverse();
+
+	list.visit(
+		[&list](auto first, auto const last)
+		{
+			dl_reversible_list<uint32_t>::iterator const decayed = first;
+			ASSERT_TRUE(decayed == list.begin());
+			for(; first != last; ++first)
+			{
+				*first *= 2;
+			}
+			ASSERT_EQ(*decayed, 14u);
+		});
+
+	ASSERT_EQ(*list.begin(), 14u);
+	list.erase(list.begin());
+	ASSERT_EQ(*list.begin(), 12u);
+}
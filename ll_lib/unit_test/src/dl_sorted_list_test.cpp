@@ -0,0 +1,343 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <functional>
+#include <random>
+#include <limits>
+#include <list>
+#include <thread>
+#include <utility>
+
+#include <ll_lib/dl_sorted_list.hpp>
+
+#include "list_equivalence.hpp"
+
+
+template<typename List>
+class dl_sorted_list_test: public ::testing::Test {};
+
+using sorted_list_types = ::testing::Types<
+	dl_sorted_list<uint32_t, std::less<uint32_t>, false>,
+	dl_sorted_list<uint32_t, std::less<uint32_t>, true>>;
+
+TYPED_TEST_SUITE(dl_sorted_list_test, sorted_list_types);
+
+TYPED_TEST(dl_sorted_list_test, empty)
+{
+	TypeParam list;
+
+	ASSERT_TRUE(list.empty());
+
+	list.insert(1235);
+
+	ASSERT_FALSE(list.empty());
+
+	list.erase(list.begin());
+
+	ASSERT_TRUE(list.empty());
+}
+
+TYPED_TEST(dl_sorted_list_test, insert_random)
+{
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<uint32_t> distrib(0, 1024);
+
+	TypeParam list;
+	std::list<uint32_t> reference;
+
+	for(uintptr_t tcount = 4096; --tcount;)
+	{
+		const uint32_t tcase = distrib(gen);
+		ASSERT_EQ(*list.insert(tcase), tcase);
+		reference.push_back(tcase);
+	}
+
+	reference.sort();
+	standard_list_equivalence_test(list, reference);
+}
+
+TYPED_TEST(dl_sorted_list_test, insert_nearly_sorted)
+{
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<uint32_t> jitter(0, 16);
+
+	TypeParam list;
+	std::list<uint32_t> reference;
+
+	for(uint32_t tcount = 0; tcount < 4096; ++tcount)
+	{
+		const uint32_t tcase = tcount * 4 + jitter(gen);
+		list.insert(tcase);
+		reference.push_back(tcase);
+	}
+
+	reference.sort();
+	standard_list_equivalence_test(list, reference);
+}
+
+TYPED_TEST(dl_sorted_list_test, insert_hint)
+{
+	TypeParam list;
+	std::list<uint32_t> reference{1, 2, 3, 4, 5, 6};
+
+	list.insert(6);
+	list.insert(1);
+	typename TypeParam::iterator const hint = list.insert(3);
+	list.insert(hint, 5);
+	list.insert(list.end(), 2);
+	list.insert(list.begin(), 4);
+
+	standard_list_equivalence_test(list, reference);
+}
+
+TYPED_TEST(dl_sorted_list_test, stable_equivalents)
+{
+	using pair_t = std::pair<uint32_t, uint32_t>;
+	struct first_less
+	{
+		bool operator()(pair_t const& p_lhs, pair_t const& p_rhs) const { return p_lhs.first < p_rhs.first; }
+	};
+
+	constexpr bool skip_index = std::is_same_v<TypeParam, dl_sorted_list<uint32_t, std::less<uint32_t>, true>>;
+	dl_sorted_list<pair_t, first_less, skip_index> list;
+	std::list<pair_t> reference;
+
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<uint32_t> distrib(0, 32);
+
+	for(uint32_t tcount = 0; tcount < 1024; ++tcount)
+	{
+		const pair_t tcase{distrib(gen), tcount};
+		list.insert(tcase);
+		reference.push_back(tcase);
+	}
+
+	reference.sort(first_less{});
+	standard_list_equivalence_test(list, reference);
+}
+
+TYPED_TEST(dl_sorted_list_test, lower_upper_bound)
+{
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<uint32_t> distrib(0, 2048);
+
+	TypeParam list;
+	std::list<uint32_t> reference;
+
+	for(uintptr_t tcount = 1024; --tcount;)
+	{
+		const uint32_t tcase = distrib(gen);
+		list.insert(tcase);
+		reference.push_back(tcase);
+	}
+	reference.sort();
+
+	for(uintptr_t tcount = 1024; --tcount;)
+	{
+		const uint32_t key = distrib(gen);
+
+		auto const std_lower = std::lower_bound(reference.cbegin(), reference.cend(), key);
+		auto const std_upper = std::upper_bound(reference.cbegin(), reference.cend(), key);
+		auto const lower = list.lower_bound(key);
+		auto const upper = list.upper_bound(key);
+
+		ASSERT_EQ(std::distance(reference.cbegin(), std_lower), std::distance(list.cbegin(), lower));
+		ASSERT_EQ(std::distance(reference.cbegin(), std_upper), std::distance(list.cbegin(), upper));
+
+		auto const found = list.find(key);
+		if(std_lower != std_upper)
+		{
+			ASSERT_FALSE(found == list.cend());
+			ASSERT_EQ(*found, key);
+		}
+		else
+		{
+			ASSERT_TRUE(found == list.cend());
+		}
+	}
+}
+
+TYPED_TEST(dl_sorted_list_test, erase)
+{
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<uint32_t> distrib(0, 256);
+
+	TypeParam list;
+	std::list<uint32_t> reference;
+
+	for(uintptr_t tcount = 2048; --tcount;)
+	{
+		const uint32_t tcase = distrib(gen);
+		list.insert(tcase);
+		reference.push_back(tcase);
+	}
+	reference.sort();
+
+	for(uintptr_t tcount = 128; --tcount;)
+	{
+		const uint32_t key = distrib(gen);
+		uintptr_t const std_count = static_cast<uintptr_t>(std::count(reference.cbegin(), reference.cend(), key));
+		reference.remove(key);
+		ASSERT_EQ(list.erase(key), std_count);
+	}
+	standard_list_equivalence_test(list, reference);
+
+	typename TypeParam::iterator it = list.begin();
+	std::list<uint32_t>::iterator std_it = reference.begin();
+	for(uintptr_t tcount = 64; --tcount;)
+	{
+		++it;
+		++std_it;
+	}
+	it     = list.erase(it);
+	std_it = reference.erase(std_it);
+	ASSERT_EQ(*it, *std_it);
+	standard_list_equivalence_test(list, reference);
+
+	list.clear();
+	ASSERT_TRUE(list.empty());
+	list.insert(7);
+	standard_list_equivalence_test(list, std::list<uint32_t>{7});
+}
+
+TYPED_TEST(dl_sorted_list_test, concurrent_lookups)
+{
+	TypeParam list;
+	for(uint32_t tcount = 0; tcount < 1024; ++tcount)
+	{
+		list.insert(tcount * 2);
+	}
+
+	TypeParam const& shared = list;
+	auto const lookup =
+		[&shared](uint32_t const p_offset)
+		{
+			for(uint32_t tcount = 0; tcount < 4096; ++tcount)
+			{
+				uint32_t const key = (tcount * 7 + p_offset) % 2047;
+				ASSERT_EQ(shared.find(key) == shared.cend(), (key & 1) != 0);
+				ASSERT_EQ(*shared.lower_bound(key), (key + 1) & ~uint32_t{1});
+			}
+		};
+
+	std::thread other(lookup, 1);
+	lookup(1000);
+	other.join();
+}
+
+#ifdef LL_LIB_TRACE_HOPS
+namespace
+{
+	constexpr uint32_t hop_test_size = 1 << 16;
+
+	///	\brief Average node hops per element of a nearly in-order stream, the finger keeps it constant.
+	constexpr uintptr_t local_hop_budget = 8;
+
+	template<typename Func>
+	uintptr_t count_hops(Func&& p_func)
+	{
+		uintptr_t const before = _p::_node_hops;
+		p_func();
+		return _p::_node_hops - before;
+	}
+} //namespace
+
+TYPED_TEST(dl_sorted_list_test, in_order_insert_hops)
+{
+	TypeParam list;
+	uintptr_t const hops = count_hops(
+		[&list]()
+		{
+			for(uint32_t tcount = 0; tcount < hop_test_size; ++tcount)
+			{
+				list.insert(tcount);
+			}
+		});
+	ASSERT_LE(hops, hop_test_size * local_hop_budget);
+}
+
+TYPED_TEST(dl_sorted_list_test, jittered_insert_hops)
+{
+	std::mt19937 gen(1);
+	TypeParam list;
+	uintptr_t const hops = count_hops(
+		[&list, &gen]()
+		{
+			for(uint32_t tcount = 0; tcount < hop_test_size; ++tcount)
+			{
+				list.insert(tcount * 4 + gen() % 16);
+			}
+		});
+	ASSERT_LE(hops, hop_test_size * local_hop_budget);
+}
+
+TYPED_TEST(dl_sorted_list_test, sequential_lookup_hops)
+{
+	TypeParam list;
+	for(uint32_t tcount = 0; tcount < hop_test_size; ++tcount)
+	{
+		list.insert(tcount);
+	}
+
+	//the finger is left at the back, lookups on a non-const list carry it along the scan
+	uintptr_t const hops = count_hops(
+		[&list]()
+		{
+			for(uint32_t tcount = 0; tcount < hop_test_size; ++tcount)
+			{
+				ASSERT_EQ(*list.lower_bound(tcount), tcount);
+			}
+		});
+	ASSERT_LE(hops, hop_test_size * local_hop_budget);
+}
+
+TEST(dl_sorted_list, skip_index_far_hops)
+{
+	using list_t = dl_sorted_list<uint32_t, std::less<uint32_t>, true>;
+	//expected O(log n) from the head of the index, the levels above the tallest tower still cost one hop each
+	constexpr uintptr_t far_hop_budget = 4 * 16 + 16;
+	constexpr uint32_t lookup_count = 1024;
+
+	std::mt19937 gen(1);
+	list_t list;
+	for(uint32_t tcount = 0; tcount < hop_test_size; ++tcount)
+	{
+		list.insert(tcount);
+	}
+
+	list_t const& shared = list;
+	uintptr_t const lookup_hops = count_hops(
+		[&shared, &gen]()
+		{
+			for(uint32_t tcount = 0; tcount < lookup_count; ++tcount)
+			{
+				uint32_t const key = gen() % hop_test_size;
+				ASSERT_EQ(*shared.lower_bound(key), key);
+			}
+		});
+	ASSERT_LE(lookup_hops, lookup_count * far_hop_budget);
+
+	uintptr_t const erase_hops = count_hops(
+		[&list, &gen]()
+		{
+			for(uint32_t tcount = 0; tcount < lookup_count; ++tcount)
+			{
+				list.erase(gen() % hop_test_size);
+			}
+		});
+	ASSERT_LE(erase_hops, lookup_count * far_hop_budget);
+}
+#endif
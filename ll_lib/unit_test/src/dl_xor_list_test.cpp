@@ -0,0 +1,172 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <random>
+#include <limits>
+#include <list>
+#include <string>
+
+#include <ll_lib/dl_xor_list.hpp>
+#include <ll_lib/node_arena.hpp>
+
+#include "list_equivalence.hpp"
+
+
+TEST(dl_xor_list, node_size)
+{
+	static_assert(sizeof(_p::_XorContainer<uint64_t>) + sizeof(void*) == sizeof(_p::_Container<uint64_t>));
+}
+
+TEST(dl_xor_list, empty)
+{
+	dl_xor_list<uint32_t> list;
+
+	ASSERT_TRUE(list.empty());
+	ASSERT_TRUE(list.begin() == list.end());
+
+	list.push_back(1235);
+
+	ASSERT_FALSE(list.empty());
+	ASSERT_EQ(*list.begin(), 1235u);
+	ASSERT_EQ(*(--list.end()), 1235u);
+
+	list.pop_back();
+
+	ASSERT_TRUE(list.empty());
+}
+
+TEST(dl_xor_list, random_operations)
+{
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<uint32_t> distrib(0, std::numeric_limits<uint32_t>::max());
+
+	dl_xor_list<uint32_t> list;
+	std::list<uint32_t> reference;
+
+	for(uintptr_t tcount = 4096; --tcount;)
+	{
+		const uint32_t tcase = distrib(gen);
+		switch(tcase % 6)
+		{
+		case 0:
+			list.push_back(tcase);
+			reference.push_back(tcase);
+			break;
+		case 1:
+			list.push_front(tcase);
+			reference.push_front(tcase);
+			break;
+		case 2:
+			if(!reference.empty())
+			{
+				list.pop_back();
+				reference.pop_back();
+			}
+			break;
+		case 3:
+			if(!reference.empty())
+			{
+				list.pop_front();
+				reference.pop_front();
+			}
+			break;
+		case 4:
+			if(!reference.empty())
+			{
+				auto it = list.begin();
+				auto std_it = reference.begin();
+				for(uint32_t step = tcase % reference.size(); step--;)
+				{
+					++it;
+					++std_it;
+				}
+				it     = list.erase(it);
+				std_it = reference.erase(std_it);
+				ASSERT_EQ(it == list.end(), std_it == reference.end());
+				if(std_it != reference.end())
+				{
+					ASSERT_EQ(*it, *std_it);
+				}
+			}
+			break;
+		default:
+			{
+				auto it = list.end();
+				auto std_it = reference.end();
+				for(uint32_t step = tcase % 8; step-- && std_it != reference.begin();)
+				{
+					--it;
+					--std_it;
+				}
+				ASSERT_EQ(*list.insert(it, tcase), tcase);
+				reference.insert(std_it, tcase);
+			}
+			break;
+		}
+		ASSERT_EQ(list.empty(), reference.empty());
+	}
+
+	standard_list_equivalence_test(list, reference);
+}
+
+TEST(dl_xor_list, erase_range)
+{
+	dl_xor_list<std::string> list;
+	std::list<std::string> reference;
+
+	for(uint32_t tcount = 0; tcount < 256; ++tcount)
+	{
+		list.push_back(std::to_string(tcount));
+		reference.push_back(std::to_string(tcount));
+	}
+
+	auto it = list.begin();
+	auto std_it = reference.begin();
+	for(uintptr_t tcount = 10; --tcount;)
+	{
+		++it;
+		++std_it;
+	}
+	auto it_last = it;
+	auto std_it_last = std_it;
+	for(uintptr_t tcount = 100; --tcount;)
+	{
+		++it_last;
+		++std_it_last;
+	}
+
+	it     = list.erase(it, it_last);
+	std_it = reference.erase(std_it, std_it_last);
+	ASSERT_EQ(*it, *std_it);
+	ASSERT_EQ(*(--it), *(--std_it));
+	standard_list_equivalence_test(list, reference);
+
+	list.erase(list.begin(), list.end());
+	ASSERT_TRUE(list.empty());
+}
+
+TEST(dl_xor_list, arena)
+{
+	dl_xor_list<uint64_t, dl_arena_node_allocator> list;
+	std::list<uint64_t> reference;
+
+	for(uint64_t tcount = 0; tcount < 1024; ++tcount)
+	{
+		list.push_front(tcount);
+		reference.push_front(tcount);
+	}
+	standard_list_equivalence_test(list, reference);
+
+	list.clear();
+	ASSERT_TRUE(list.empty());
+	list.push_back(5);
+	ASSERT_EQ(*list.begin(), 5u);
+}
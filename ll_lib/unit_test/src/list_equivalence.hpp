@@ -0,0 +1,45 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <list>
+
+///	\brief Checks that \p p_list holds the same elements as \p p_reference, walking it in both directions.
+///	\tparam List - any of the library lists, iterated through its const and const reverse iterators.
+template<typename List, typename T>
+void standard_list_equivalence_test(List const& p_list, std::list<T> const& p_reference)
+{
+	{
+		using dl_it = typename List::const_iterator;
+		dl_it it = p_list.cbegin();
+		for(T const& ref : p_reference)
+		{
+			ASSERT_FALSE(it == p_list.cend());
+			ASSERT_EQ(ref, *it);
+			++it;
+		}
+		ASSERT_TRUE(it == p_list.cend());
+	}
+
+	{
+		using dl_it  = typename List::const_reverse_iterator;
+		using std_it = typename std::list<T>::const_reverse_iterator;
+		dl_it it = p_list.crbegin();
+		for(
+			std_it it_r = p_reference.crbegin(), it_end_r = p_reference.crend();
+			it_r != it_end_r;
+			++it_r, ++it)
+		{
+			ASSERT_FALSE(it == p_list.crend());
+			ASSERT_EQ(*it_r, *it);
+		}
+		ASSERT_TRUE(it == p_list.crend());
+	}
+}
@@ -8,11 +8,18 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include <algorithm>
 #include <random>
 #include <limits>
 #include <list>
+#include <new>
+#include <string>
+#include <vector>
 
 #include <ll_lib/ll_lib.hpp>
+#include <ll_lib/node_arena.hpp>
+
+#include "list_equivalence.hpp"
 
 
 class ConstructionTester
@@ -39,35 +46,6 @@ public:
 	Type const m_type;
 };
 
-template<typename T>
-void standard_list_equivalence_test(dl_list<T> const& p_list, std::list<T> const& p_reference)
-{
-	{
-		using dl_it = typename dl_list<T>::const_iterator;
-		dl_it it = p_list.cbegin();
-		for(T const& ref : p_reference)
-		{
-			ASSERT_EQ(ref, *it);
-			++it;
-		}
-		ASSERT_TRUE(it == p_list.cend());
-	}
-
-	{
-		using dl_it  = typename dl_list<T>::const_reverse_iterator;
-		using std_it = typename std::list<T>::const_reverse_iterator;
-		dl_it it = p_list.crbegin();
-		for(
-			std_it it_r = p_reference.crbegin(), it_end_r = p_reference.crend();
-			it_r != it_end_r;
-			++it_r, ++it)
-		{
-			ASSERT_EQ(*it_r, *it);
-		}
-		ASSERT_TRUE(it == p_list.crend());
-	}
-}
-
 TEST(dl_list, empty)
 {
 	dl_list<uint32_t> list;
@@ -385,3 +363,256 @@ TEST(dl_list, erase)
 	ASSERT_EQ(*it, *std_it);
 	standard_list_equivalence_test(list, reference);
 }
+
+namespace
+{
+	///	\brief Owning handle, relocatable with memcpy but neither trivially copyable nor trivially destructible.
+	class RelocatableTester
+	{
+	public:
+		inline RelocatableTester(uint32_t p_val): m_val{new uint32_t{p_val}} {}
+		inline RelocatableTester(RelocatableTester const& p_other): m_val{new uint32_t{*p_other.m_val}} {}
+		inline RelocatableTester(RelocatableTester&& p_other) noexcept: m_val{p_other.m_val} { p_other.m_val = nullptr; ++s_moves; }
+		inline ~RelocatableTester() { delete m_val; }
+
+		RelocatableTester& operator = (RelocatableTester const&) = delete;
+
+		bool operator == (RelocatableTester const& p_other) const { return *m_val == *p_other.m_val; }
+
+		static inline uintptr_t s_moves = 0;
+	private:
+		uint32_t* m_val;
+	};
+} //namespace
+
+template<>
+struct dl_is_trivially_relocatable<RelocatableTester>: std::true_type {};
+
+TEST(dl_list, copy)
+{
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<uint32_t> distrib(0, 1024);
+
+	dl_list<uint32_t> list;
+	std::list<uint32_t> reference;
+	for(uintptr_t tcount = 512; --tcount;)
+	{
+		const uint32_t tcase = distrib(gen);
+		list.push_back(tcase);
+		reference.push_back(tcase);
+	}
+
+	dl_list<uint32_t> copy{list};
+	standard_list_equivalence_test(copy, reference);
+	standard_list_equivalence_test(list, reference);
+
+	dl_list<uint32_t> shorter;
+	shorter.push_back(1);
+	shorter = list;
+	standard_list_equivalence_test(shorter, reference);
+
+	reference.resize(64);
+	dl_list<uint32_t> prefix;
+	for(uint32_t const val : reference)
+	{
+		prefix.push_back(val);
+	}
+	copy = prefix;
+	standard_list_equivalence_test(copy, reference);
+
+	copy = copy;
+	standard_list_equivalence_test(copy, reference);
+}
+
+TEST(dl_list, copy_modes)
+{
+	dl_list<ConstructionTester> list;
+	list.emplace(list.end());
+	list.emplace(list.end(), uint32_t{66666});
+
+	dl_list<ConstructionTester> copy{list};
+	for(ConstructionTester const& val : copy)
+	{
+		ASSERT_EQ(val.type(), ConstructionTester::Type::copy_ctor);
+	}
+
+	dl_list<RelocatableTester> relocatable;
+	relocatable.push_back(RelocatableTester{7});
+	dl_list<RelocatableTester> relocatable_copy{relocatable};
+	relocatable_copy = relocatable;
+	ASSERT_TRUE(*relocatable.begin() == *relocatable_copy.begin());
+}
+
+TEST(dl_list, move)
+{
+	dl_list<uint32_t> list;
+	std::list<uint32_t> reference{1, 2, 3};
+	for(uint32_t const val : reference)
+	{
+		list.push_back(val);
+	}
+
+	dl_list<uint32_t> moved{std::move(list)};
+	ASSERT_TRUE(list.empty());
+	standard_list_equivalence_test(moved, reference);
+
+	list.push_back(5);
+	list = std::move(moved);
+	ASSERT_TRUE(moved.empty());
+	standard_list_equivalence_test(list, reference);
+
+	dl_list<uint32_t> empty;
+	list = std::move(empty);
+	ASSERT_TRUE(list.empty());
+}
+
+TEST(dl_list, compact)
+{
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<uint32_t> distrib(0, 1024);
+
+	dl_list<uint32_t> list;
+	std::list<uint32_t> reference;
+	for(uintptr_t tcount = 1024; --tcount;)
+	{
+		const uint32_t tcase = distrib(gen);
+		list.push_front(tcase);
+		reference.push_front(tcase);
+	}
+
+	list.compact();
+	standard_list_equivalence_test(list, reference);
+
+	dl_list<RelocatableTester> relocatable;
+	for(uint32_t tcount = 0; tcount < 16; ++tcount)
+	{
+		relocatable.emplace(relocatable.begin(), tcount);
+	}
+	uintptr_t const moves = RelocatableTester::s_moves;
+	relocatable.compact();
+	ASSERT_EQ(RelocatableTester::s_moves, moves);
+
+	uint32_t expected = 16;
+	for(RelocatableTester const& val : relocatable)
+	{
+		ASSERT_TRUE(val == RelocatableTester{--expected});
+	}
+	ASSERT_EQ(expected, 0u);
+}
+
+namespace
+{
+	///	\brief Node policy that fails once \p s_remaining allocations have been served.
+	template<typename Base>
+	struct ThrowingNodeAllocator: public Base
+	{
+		[[nodiscard]] inline ThrowingNodeAllocator fresh() const { return ThrowingNodeAllocator{Base::fresh()}; }
+
+		template<typename Node>
+		[[nodiscard]] inline void* allocate()
+		{
+			if(s_remaining == 0)
+			{
+				throw std::bad_alloc{};
+			}
+			--s_remaining;
+			return Base::template allocate<Node>();
+		}
+
+		static inline uintptr_t s_remaining = std::numeric_limits<uintptr_t>::max();
+	};
+
+	template<typename T, typename Base, typename Make>
+	void compact_allocation_failure_test(Make const p_make)
+	{
+		using Alloc = ThrowingNodeAllocator<Base>;
+		dl_list<T, Alloc> list;
+		std::list<T> reference;
+		for(uint32_t tcount = 0; tcount < 16; ++tcount)
+		{
+			list.push_front(p_make(tcount));
+			reference.push_front(p_make(tcount));
+		}
+
+		Alloc::s_remaining = 3;
+		ASSERT_THROW(list.compact(), std::bad_alloc);
+		Alloc::s_remaining = std::numeric_limits<uintptr_t>::max();
+		standard_list_equivalence_test(list, reference);
+
+		list.compact();
+		standard_list_equivalence_test(list, reference);
+	}
+} //namespace
+
+TEST(dl_list, compact_allocation_failure)
+{
+	compact_allocation_failure_test<uint32_t, dl_heap_node_allocator>([](uint32_t const p_val) { return p_val; });
+	compact_allocation_failure_test<std::string, dl_heap_node_allocator>([](uint32_t const p_val) { return std::to_string(p_val); });
+	compact_allocation_failure_test<uint64_t, dl_arena_node_allocator>([](uint32_t const p_val) { return uint64_t{p_val}; });
+}
+
+namespace
+{
+	///	\brief Node policy that only gives nodes back on reset(), its destructor and move assignment drop them.
+	struct ResetOnlyNodeAllocator
+	{
+		[[nodiscard]] inline ResetOnlyNodeAllocator fresh() const { return {}; }
+
+		template<typename Node>
+		[[nodiscard]] inline void* allocate()
+		{
+			m_nodes.push_back(::operator new(sizeof(Node)));
+			++s_outstanding;
+			return m_nodes.back();
+		}
+
+		template<typename Node>
+		inline void deallocate(void* const p_node) noexcept
+		{
+			m_nodes.erase(std::find(m_nodes.begin(), m_nodes.end(), p_node));
+			::operator delete(p_node);
+			--s_outstanding;
+		}
+
+		void reset() noexcept
+		{
+			for(void* const node : m_nodes)
+			{
+				::operator delete(node);
+			}
+			s_outstanding -= m_nodes.size();
+			m_nodes.clear();
+		}
+
+		static inline uintptr_t s_outstanding = 0;
+
+		std::vector<void*> m_nodes;
+	};
+} //namespace
+
+TEST(dl_list, bulk_reset_policy)
+{
+	{
+		dl_list<uint32_t, ResetOnlyNodeAllocator> list;
+		for(uint32_t tcount = 0; tcount < 16; ++tcount)
+		{
+			list.push_back(tcount);
+		}
+		ASSERT_EQ(ResetOnlyNodeAllocator::s_outstanding, 16u);
+
+		list.compact();
+		ASSERT_EQ(ResetOnlyNodeAllocator::s_outstanding, 16u);
+
+		dl_list<uint32_t, ResetOnlyNodeAllocator> other;
+		for(uint32_t tcount = 0; tcount < 8; ++tcount)
+		{
+			other.push_back(tcount);
+		}
+		list = std::move(other);
+		ASSERT_EQ(ResetOnlyNodeAllocator::s_outstanding, 8u);
+		standard_list_equivalence_test(list, std::list<uint32_t>{0, 1, 2, 3, 4, 5, 6, 7});
+	}
+	ASSERT_EQ(ResetOnlyNodeAllocator::s_outstanding, 0u);
+}
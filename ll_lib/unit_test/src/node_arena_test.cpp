@@ -0,0 +1,174 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <random>
+#include <limits>
+#include <list>
+#include <utility>
+
+#include <ll_lib/ll_lib.hpp>
+#include <ll_lib/node_arena.hpp>
+
+using arena_list = dl_list<uint64_t, dl_arena_node_allocator>;
+
+TEST(dl_arena_node_allocator, equivalence)
+{
+	std::random_device rd;
+	std::mt19937 gen(rd());
+	std::uniform_int_distribution<uint64_t> distrib(0, std::numeric_limits<uint64_t>::max());
+
+	arena_list list;
+	std::list<uint64_t> reference;
+
+	for(uintptr_t tcount = 4096; --tcount;)
+	{
+		const uint64_t tcase = distrib(gen);
+		if(tcase & 1)
+		{
+			list.push_back(tcase);
+			reference.push_back(tcase);
+		}
+		else
+		{
+			list.push_front(tcase);
+			reference.push_front(tcase);
+		}
+	}
+
+	for(uintptr_t tcount = 1024; --tcount;)
+	{
+		list.pop_front();
+		reference.pop_front();
+		list.pop_back();
+		reference.pop_back();
+	}
+
+	arena_list::const_iterator it = list.cbegin();
+	for(uint64_t const ref : reference)
+	{
+		ASSERT_EQ(ref, *it);
+		++it;
+	}
+	ASSERT_TRUE(it == list.cend());
+}
+
+TEST(dl_arena_node_allocator, insertion_order_placement)
+{
+	arena_list list;
+
+	for(uint64_t tcount = 0; tcount < 1024; ++tcount)
+	{
+		list.push_back(tcount);
+	}
+
+	uint64_t const* last = nullptr;
+	for(uint64_t const& val : list)
+	{
+		if(last)
+		{
+			ASSERT_LT(last, &val);
+		}
+		last = &val;
+	}
+	ASSERT_EQ(list.get_allocator().arena_count(), 1u);
+}
+
+TEST(dl_arena_node_allocator, reuse)
+{
+	arena_list list;
+
+	list.push_back(1);
+	uint64_t const* const first = &*list.begin();
+	list.pop_back();
+	list.push_back(2);
+
+	ASSERT_EQ(first, &*list.begin());
+}
+
+TEST(dl_arena_node_allocator, grow)
+{
+	arena_list list{std::in_place, dl_arena_node_allocator::huge_page_size};
+
+	uintptr_t const count = 2 * dl_arena_node_allocator::huge_page_size / sizeof(_p::_Container<uint64_t>);
+	for(uintptr_t tcount = 0; tcount < count; ++tcount)
+	{
+		list.push_back(tcount);
+	}
+
+	ASSERT_GE(list.get_allocator().arena_count(), 2u);
+
+	uintptr_t expected = 0;
+	for(uint64_t const val : list)
+	{
+		ASSERT_EQ(val, expected++);
+	}
+	ASSERT_EQ(expected, count);
+
+	list.clear();
+	ASSERT_TRUE(list.empty());
+}
+
+TEST(dl_arena_node_allocator, clear_reset)
+{
+	arena_list list{std::in_place, dl_arena_node_allocator::huge_page_size};
+
+	uintptr_t const count = 2 * dl_arena_node_allocator::huge_page_size / sizeof(_p::_Container<uint64_t>);
+	for(uintptr_t tcount = 0; tcount < count; ++tcount)
+	{
+		list.push_back(tcount);
+	}
+	ASSERT_GE(list.get_allocator().arena_count(), 2u);
+
+	list.clear();
+	ASSERT_TRUE(list.empty());
+	ASSERT_EQ(list.get_allocator().arena_count(), 1u);
+
+	list.push_back(3);
+	list.push_back(4);
+	ASSERT_EQ(*list.begin(), 3u);
+	ASSERT_EQ(*(--list.end()), 4u);
+}
+
+TEST(dl_arena_node_allocator, copy_compact)
+{
+	arena_list list;
+	std::list<uint64_t> reference;
+
+	for(uint64_t tcount = 0; tcount < 1024; ++tcount)
+	{
+		list.push_front(tcount);
+		reference.push_front(tcount);
+	}
+	for(uintptr_t tcount = 256; --tcount;)
+	{
+		list.pop_back();
+		reference.pop_back();
+	}
+
+	arena_list copy{list};
+	copy.compact();
+
+	uint64_t const* last = nullptr;
+	std::list<uint64_t>::const_iterator std_it = reference.cbegin();
+	for(uint64_t const& val : copy)
+	{
+		ASSERT_EQ(val, *std_it++);
+		if(last)
+		{
+			ASSERT_LT(last, &val);
+		}
+		last = &val;
+	}
+	ASSERT_TRUE(std_it == reference.cend());
+
+	arena_list moved{std::move(copy)};
+	ASSERT_TRUE(copy.empty());
+	ASSERT_EQ(*moved.begin(), *reference.begin());
+}
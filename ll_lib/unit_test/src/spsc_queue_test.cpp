@@ -0,0 +1,194 @@
+//======== ======== ======== ======== ======== ======== ======== ========
+///	\file
+///
+///	\copyright
+///
+//======== ======== ======== ======== ======== ======== ======== ========
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ll_lib/spsc_queue.hpp>
+
+
+TEST(dl_spsc_queue, push_pop)
+{
+	dl_spsc_queue<uint32_t> queue{4};
+	uint32_t out = 0;
+
+	ASSERT_EQ(queue.capacity(), 4u);
+	ASSERT_TRUE(queue.empty_approx());
+	ASSERT_FALSE(queue.try_pop(out));
+
+	for(uint32_t tcount = 0; tcount < 4; ++tcount)
+	{
+		ASSERT_TRUE(queue.try_push(tcount));
+	}
+	ASSERT_FALSE(queue.try_push(uint32_t{4}));
+	ASSERT_EQ(queue.size_approx(), 4u);
+
+	ASSERT_TRUE(queue.try_pop(out));
+	ASSERT_EQ(out, 0u);
+	ASSERT_TRUE(queue.try_push(uint32_t{4}));
+
+	for(uint32_t tcount = 1; tcount < 5; ++tcount)
+	{
+		ASSERT_TRUE(queue.try_pop(out));
+		ASSERT_EQ(out, tcount);
+	}
+	ASSERT_FALSE(queue.try_pop(out));
+}
+
+TEST(dl_spsc_queue, batch)
+{
+	dl_spsc_queue<uint32_t> queue{10};
+	std::array<uint32_t, 8> in{0, 1, 2, 3, 4, 5, 6, 7};
+	std::array<uint32_t, 8> out{};
+
+	ASSERT_EQ(queue.push_batch(in.begin(), in.size()), 8u);
+	ASSERT_EQ(queue.push_batch(in.begin(), in.size()), 2u);
+	ASSERT_EQ(queue.push_batch(in.begin(), in.size()), 0u);
+
+	ASSERT_EQ(queue.pop_batch(out.begin(), 5), 5u);
+	for(uint32_t tcount = 0; tcount < 5; ++tcount)
+	{
+		ASSERT_EQ(out[tcount], tcount);
+	}
+
+	ASSERT_EQ(queue.pop_batch(out.begin(), out.size()), 5u);
+	ASSERT_EQ(out[0], 5u);
+	ASSERT_EQ(out[2], 7u);
+	ASSERT_EQ(out[3], 0u);
+	ASSERT_EQ(out[4], 1u);
+	ASSERT_EQ(queue.pop_batch(out.begin(), out.size()), 0u);
+}
+
+TEST(dl_spsc_queue, non_trivial)
+{
+	std::string out;
+	{
+		dl_spsc_queue<std::string> queue{3};
+		ASSERT_TRUE(queue.try_emplace(64, 'a'));
+		ASSERT_TRUE(queue.try_push(std::string(64, 'b')));
+		ASSERT_TRUE(queue.try_pop(out));
+		ASSERT_EQ(out, std::string(64, 'a'));
+		ASSERT_TRUE(queue.try_emplace(64, 'c'));
+		ASSERT_TRUE(queue.try_emplace(64, 'd'));
+		//remaining elements are released by the destructor
+	}
+}
+
+namespace
+{
+	///	\brief Counts live instances, move assignment throws once s_throw_after assignments have succeeded.
+	class ThrowingAssignTester
+	{
+	public:
+		inline ThrowingAssignTester(): m_val{new uint32_t{0}} { ++s_live; }
+		inline ThrowingAssignTester(uint32_t const p_val): m_val{new uint32_t{p_val}} { ++s_live; }
+		inline ThrowingAssignTester(ThrowingAssignTester const& p_other): m_val{new uint32_t{*p_other.m_val}} { ++s_live; }
+		inline ~ThrowingAssignTester() { delete m_val; --s_live; }
+
+		ThrowingAssignTester& operator = (ThrowingAssignTester&& p_other)
+		{
+			if(s_throw_after == 0)
+			{
+				throw std::runtime_error{"assignment"};
+			}
+			--s_throw_after;
+			*m_val = *p_other.m_val;
+			return *this;
+		}
+
+		[[nodiscard]] inline uint32_t value() const { return *m_val; }
+
+		static inline intptr_t s_live = 0;
+		static inline uintptr_t s_throw_after = static_cast<uintptr_t>(-1);
+	private:
+		uint32_t* m_val;
+	};
+} //namespace
+
+TEST(dl_spsc_queue, pop_batch_exception)
+{
+	{
+		dl_spsc_queue<ThrowingAssignTester> queue{8};
+		for(uint32_t tcount = 0; tcount < 6; ++tcount)
+		{
+			ASSERT_TRUE(queue.try_emplace(tcount));
+		}
+
+		std::array<ThrowingAssignTester, 6> out;
+		ThrowingAssignTester::s_throw_after = 2;
+		ASSERT_THROW(queue.pop_batch(out.begin(), out.size()), std::runtime_error);
+		ThrowingAssignTester::s_throw_after = static_cast<uintptr_t>(-1);
+
+		ASSERT_EQ(out[0].value(), 0u);
+		ASSERT_EQ(out[1].value(), 1u);
+		ASSERT_EQ(queue.size_approx(), 4u);
+
+		ASSERT_EQ(queue.pop_batch(out.begin(), out.size()), 4u);
+		for(uint32_t tcount = 0; tcount < 4; ++tcount)
+		{
+			ASSERT_EQ(out[tcount].value(), tcount + 2);
+		}
+		ASSERT_TRUE(queue.empty_approx());
+		ASSERT_EQ(ThrowingAssignTester::s_live, 6);
+	}
+	ASSERT_EQ(ThrowingAssignTester::s_live, 0);
+}
+
+TEST(dl_spsc_queue, two_threads)
+{
+	constexpr uint64_t message_count = 1 << 16;
+	dl_spsc_queue<uint64_t> queue{1024};
+
+	std::thread producer(
+		[&queue]()
+		{
+			std::array<uint64_t, 32> batch;
+			uint64_t next = 0;
+			while(next < message_count)
+			{
+				if(next & 1)
+				{
+					if(queue.try_push(next)) ++next;
+					continue;
+				}
+				for(uint64_t& val : batch)
+				{
+					val = next + (&val - batch.data());
+				}
+				uint64_t const remaining = message_count - next;
+				next += queue.push_batch(batch.begin(), remaining < batch.size() ? remaining : batch.size());
+			}
+		});
+
+	std::vector<uint64_t> received;
+	received.reserve(message_count);
+	std::array<uint64_t, 16> batch;
+	while(received.size() < message_count)
+	{
+		uint64_t val;
+		if(received.size() & 1)
+		{
+			if(queue.try_pop(val)) received.push_back(val);
+			continue;
+		}
+		uintptr_t const count = queue.pop_batch(batch.begin(), batch.size());
+		received.insert(received.end(), batch.begin(), batch.begin() + count);
+	}
+	producer.join();
+
+	for(uint64_t tcount = 0; tcount < message_count; ++tcount)
+	{
+		ASSERT_EQ(received[tcount], tcount);
+	}
+	ASSERT_TRUE(queue.empty_approx());
+}